@@ -68,5 +68,6 @@ protected:
 	const ArchivedFileInfo *		getArchivedFileInfo(const AsciiString& filename) const;	///< return the ArchivedFileInfo from the directory tree.
 
 	File *m_file; ///< file pointer to the archive file on disk.  Kept open so we don't have to continuously open and close the file all the time.
-	DetailedArchivedDirectoryInfo m_rootDirectory;
+	DetailedArchivedDirectoryInfo m_rootDirectory; ///< sorted, for directory listings
+	ArchivedFileInfoIndex m_fileIndex; ///< for file lookups, which do not need to walk the directory tree
 };
@@ -86,6 +86,8 @@ typedef std::map<AsciiString, ArchivedDirectoryInfo> ArchivedDirectoryInfoMap; /
 typedef std::map<AsciiString, ArchivedFileInfo> ArchivedFileInfoMap; // Archived file name to archived file info
 typedef std::map<AsciiString, ArchiveFile *> ArchiveFileMap; // Archive file name to archive data
 typedef std::multimap<AsciiString, ArchiveFile *> ArchivedFileLocationMap; // Archived file name to archive data
+typedef std::hash_map<AsciiString, const ArchivedFileInfo *, rts::hash<AsciiString>, rts::equal_to<AsciiString> > ArchivedFileInfoIndex; // Archived file path to archived file info
+typedef std::hash_map<AsciiString, std::vector<ArchiveFile *>, rts::hash<AsciiString>, rts::equal_to<AsciiString> > ArchivedFileLocationIndex; // Archived file path to archive data, in instance order
 
 class ArchivedDirectoryInfo
 {
@@ -150,6 +152,12 @@ public:
 
 	ArchivedDirectoryInfo* friend_getArchivedDirectoryInfo(const Char* directory);
 
+	// TheSuperHackers @performance 18/10/2026
+	// Returns the key of a file path in the archive indices: the path in lower case with single backslashes.
+	// It resolves a path the same way as the walk through the directory tree does, so a file is found in the
+	// index exactly when it is found in the tree.
+	static AsciiString makeLookupKey(const Char *path);
+
 protected:
 	struct ArchivedDirectoryInfoResult
 	{
@@ -163,9 +171,11 @@ protected:
 	ArchivedDirectoryInfoResult getArchivedDirectoryInfo(const Char* directory);
 
 	virtual void loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool overwrite = FALSE);	///< load the archive file's header information and apply it to the global archive directory tree.
+	void removeFromFileIndex(ArchiveFile *archiveFile);	///< forget the files of an archive file that is closed
 
 	ArchiveFileMap m_archiveFileMap;
-	ArchivedDirectoryInfo m_rootDirectory;
+	ArchivedDirectoryInfo m_rootDirectory; ///< sorted, for directory listings
+	ArchivedFileLocationIndex m_fileIndex; ///< for file lookups, which do not need to walk the directory tree
 };
 
 
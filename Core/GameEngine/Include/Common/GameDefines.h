@@ -127,6 +127,11 @@
 #define RETAIL_COMPATIBLE_PATHFINDING (0)
 #endif
 
+// This is here to easily toggle between the binary heap and the sorted linked list for the fixed pathfinding open list
+#ifndef PATHFIND_OPEN_LIST_HEAP
+#define PATHFIND_OPEN_LIST_HEAP (1)
+#endif
+
 // This is here to easily toggle between the retail compatible pathfinding memory allocation and the new static allocated data mode
 #ifndef RETAIL_COMPATIBLE_PATHFINDING_ALLOCATION
 //MODDD - was 1, changed to 0 for more fixes
@@ -201,6 +201,12 @@
 
 #endif // MEMORYPOOL_DEBUG
 
+// TheSuperHackers @performance 18/10/2026 Threads can keep their own caches of free pool blocks, see
+// initMemoryPoolThreadCache(). They are off with the memory pool debugging, which tracks every single block.
+#if !defined(MEMORYPOOL_DEBUG) && !defined(MEMORYPOOL_CHECKPOINTING) && !defined(DISABLE_MEMORYPOOL_THREAD_CACHE)
+	#define MEMORYPOOL_THREAD_CACHE
+#endif
+
 // TheSuperHackers @build xezon 30/03/2025 Define DISABLE_GAMEMEMORY to use a null implementations for Game Memory.
 // Useful for address sanitizer checks and other investigations.
 // Is included below the macros so that memory pool debug code can still be used.
@@ -248,6 +254,7 @@ class MemoryPool;
 class MemoryPoolFactory;
 class DynamicMemoryAllocator;
 class BlockCheckpointInfo;
+struct MemoryPoolMagazine;
 
 // TYPE DEFINES ///////////////////////////////////////////////////////////////
 
@@ -328,9 +335,12 @@ private:
 	Int								m_usedBlocksInPool;					///< total number of blocks in use in the pool.
 	Int								m_totalBlocksInPool;				///< total number of blocks in all blobs of this pool (used or not).
 	Int								m_peakUsedBlocksInPool;			///< high-water mark of m_usedBlocksInPool
+	Int								m_overflowBlobCount;				///< number of overflow blobs created since the statistics were reset
 	MemoryPoolBlob		*m_firstBlob;								///< head of linked list: first blob for this pool.
 	MemoryPoolBlob		*m_lastBlob;								///< tail of linked list: last blob for this pool. (needed for efficiency)
 	MemoryPoolBlob		*m_firstBlobWithFreeBlocks;	///< first blob in this pool that has at least one unallocated block.
+	Int								m_threadCacheIndex;					///< index of this pool in the thread caches, -1 if it is not cached
+	Int								m_threadCacheBatchSize;			///< number of blocks moved between a thread cache and the blobs at once
 
 private:
 	/// create a new blob with the given number of blocks.
@@ -339,6 +349,18 @@ private:
 	/// destroy a blob.
 	Int freeBlob(MemoryPoolBlob *blob);
 
+	/// return a blob with free blocks. creates one if allowed and needed, else returns null if there is none.
+	MemoryPoolBlob* findBlobWithFreeBlocks(Bool allowGrowth);
+
+#ifdef MEMORYPOOL_THREAD_CACHE
+	friend void shutdownMemoryPoolThreadCache();
+
+	MemoryPoolMagazine *getThreadMagazine();													///< cache of the calling thread for this pool, or null
+	void refillMagazine(MemoryPoolMagazine *magazine);								///< move a batch of blocks from the blobs to the magazine
+	void flushMagazine(MemoryPoolMagazine *magazine, Int blockCount);	///< move blocks from the magazine back to the blobs
+	Int countBlocksInThreadCaches();																	///< number of free blocks held by all thread caches
+#endif
+
 public:
 
 	// 'public' funcs that are really only for use by MemoryPoolFactory
@@ -397,6 +419,15 @@ public:
 	/// return the initial allocation count for this pool
 	Int getInitialBlockCount();
 
+	/// return the overflow allocation count for this pool
+	Int getOverflowBlockCount();
+
+	/// return the number of overflow blobs created since the pool was initialized or resetStatistics() was called
+	Int getOverflowBlobCount();
+
+	/// restart the high-water mark at the current usage and forget the overflow blobs created so far.
+	void resetStatistics();
+
 	Int countBlobsInPool();
 
 	/// if this pool has any empty blobs, return them to the system.
@@ -572,6 +603,12 @@ public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = nullptr );
 
+	/// restart the high-water marks and overflow blob counts of all pools, see MemoryPool::resetStatistics().
+	void resetPoolStatistics();
+
+	/// write the sizes, usage and overflow blob counts of all pools as CSV. unlike memoryPoolUsageReport, this works in all builds.
+	void poolStatisticsReport(FILE *fp);
+
 	#ifdef MEMORYPOOL_DEBUG
 
 		/// perform internal consistency checking
@@ -802,10 +839,14 @@ inline MemoryPool *MemoryPool::getNextPoolInList() { return m_nextPoolInFactory;
 inline const char *MemoryPool::getPoolName() { return m_poolName; }
 inline Int MemoryPool::getAllocationSize() { return m_allocationSize; }
 inline Int MemoryPool::getFreeBlockCount() { return getTotalBlockCount() - getUsedBlockCount(); }
+#ifndef MEMORYPOOL_THREAD_CACHE
 inline Int MemoryPool::getUsedBlockCount() { return m_usedBlocksInPool; }
+#endif
 inline Int MemoryPool::getTotalBlockCount() { return m_totalBlocksInPool; }
 inline Int MemoryPool::getPeakBlockCount() { return m_peakUsedBlocksInPool; }
 inline Int MemoryPool::getInitialBlockCount() { return m_initialAllocationCount; }
+inline Int MemoryPool::getOverflowBlockCount() { return m_overflowAllocationCount; }
+inline Int MemoryPool::getOverflowBlobCount() { return m_overflowBlobCount; }
 
 // ----------------------------------------------------------------------------
 inline DynamicMemoryAllocator *DynamicMemoryAllocator::getNextDmaInList() { return m_nextDmaInFactory; }
@@ -842,6 +883,17 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+/**
+	TheSuperHackers @performance 18/10/2026
+	Give the calling thread its own cache of free blocks for each growable memory pool. Most allocations
+	and frees on the thread then take no lock at all, and only a batch of blocks at a time is moved between
+	the cache and the shared pool. Threads without a cache use the shared pools as before. The thread that
+	inits the memory manager gets one automatically. Any other thread must call shutdownMemoryPoolThreadCache()
+	before it exits, which returns its cached blocks to the pools.
+*/
+extern void initMemoryPoolThreadCache();
+extern void shutdownMemoryPoolThreadCache();
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
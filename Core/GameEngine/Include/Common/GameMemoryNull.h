@@ -65,6 +65,8 @@ class MemoryPoolFactory
 public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = nullptr );
+	void resetPoolStatistics();
+	void poolStatisticsReport(FILE *fp);
 
 #ifdef MEMORYPOOL_DEBUG
 
@@ -139,6 +141,12 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+/**
+	There are no memory pools to cache, so these do nothing.
+*/
+extern void initMemoryPoolThreadCache();
+extern void shutdownMemoryPoolThreadCache();
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
@@ -0,0 +1,68 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/AsciiString.h"
+#include "Common/STLTypedefs.h"
+
+struct INICacheEntry
+{
+	Int64 m_size;											///< size of the INI file
+	Int64 m_timestamp;								///< time stamp of the INI file, or of the archive it is in
+	UnsignedInt m_lineCount;					///< number of lines, the last one is the one at the end of the file
+	std::vector<char> m_lines;				///< each line as an UnsignedShort length, the characters and a terminating 0
+	Bool m_used;											///< was read or added since the cache was loaded
+};
+
+// TheSuperHackers @performance 18/10/2026
+// Keeps the lines of the INI files as INI::readLine produces them (comments cut off and whitespace turned
+// into spaces) in one binary file in the user data folder. The next start of the game then parses the INI
+// files from the cache instead of opening and reading through each file again. A file is taken from the
+// cache when its size and time stamp still match. Files in an archive have the time stamp of the archive.
+// Parsing sees the same lines as before, so the loaded data and the INI CRC do not change.
+// Without a cache file, it only holds the lines prefetched during the engine startup.
+class INICache
+{
+public:
+	INICache();
+	~INICache();
+
+	void load(const AsciiString& cacheFilename);	///< reads the cache file. A missing, outdated or broken cache file is ignored
+	void save();																	///< writes the INI files used since load() back to the cache file, if any was added
+
+	const INICacheEntry *findEntry(const AsciiString& iniFilename, Int64 size, Int64 timestamp); ///< null if there is no up to date entry
+	void addEntry(const AsciiString& iniFilename, Int64 size, Int64 timestamp, UnsignedInt lineCount, const std::vector<char>& lines);
+
+	// TheSuperHackers @performance 18/10/2026
+	// Adds all INI files in the given directory and its subdirectories that are not in the cache yet. The files
+	// are read on the calling thread, because the file systems are not thread safe, and are split into lines
+	// on TheWorkerThreadPool. This does not parse anything, so the INI files must still be loaded in order.
+	void prefetchDirectory(const AsciiString& dirName);
+
+private:
+	typedef std::hash_map<AsciiString, INICacheEntry, rts::hash<AsciiString>, rts::equal_to<AsciiString> > EntryMap;
+
+	static AsciiString makeKey(const AsciiString& iniFilename); ///< the archives and the local file system spell paths differently
+
+	AsciiString m_cacheFilename;
+	EntryMap m_entries;
+	Bool m_changed;
+};
+
+extern INICache *TheINICache;
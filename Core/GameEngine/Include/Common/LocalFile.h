@@ -62,6 +62,15 @@
 //           Type Defines
 //----------------------------------------------------------------------------
 
+// TheSuperHackers @performance 18/10/2026 A read only view of a part of a local file, see LocalFile::mapView.
+struct LocalFileView
+{
+	LocalFileView() : m_base(nullptr), m_size(0) {}
+
+	void *m_base;											///< start of the mapping, aligned to the allocation granularity
+	size_t m_size;										///< size of the mapping
+};
+
 //===============================
 // LocalFile
 //===============================
@@ -117,6 +126,12 @@ class LocalFile : public File
 		virtual char* readEntireAndClose() override;
 		virtual File* convertToRAMFile() override;
 
+		// TheSuperHackers @performance 18/10/2026 Maps the given range of the file read only into memory and
+		// returns a pointer to its first byte, or null if it cannot be mapped. The pages are only read from disk
+		// when they are touched. The view stays valid after the file is closed and must be released with unmapView.
+		const char*		mapView( Int offset, Int size, LocalFileView &view );
+		static void		unmapView( LocalFileView &view );
+
 	protected:
 
 		void closeWithoutDelete();
@@ -0,0 +1,98 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/GameCommon.h"
+
+// TheSuperHackers @feature 18/10/2026
+// Measures the time of each stage of GameLogic::update and writes one CSV line per logic frame.
+// It is enabled with -replayProfile during replay simulation and writes "<replay>.frames.csv"
+// next to each simulated replay. Stages can nest (the pathfind queue is part of the AI update).
+enum LogicFrameStage CPP_11(: Int)
+{
+	LOGIC_FRAME_STAGE_SCRIPT_ENGINE,
+	LOGIC_FRAME_STAGE_TERRAIN_LOGIC,
+	LOGIC_FRAME_STAGE_CRC,
+	LOGIC_FRAME_STAGE_COMMAND_LIST,
+	LOGIC_FRAME_STAGE_NORMAL_UPDATES,
+	LOGIC_FRAME_STAGE_SLEEPY_UPDATES,
+	LOGIC_FRAME_STAGE_AI,
+	LOGIC_FRAME_STAGE_PATHFIND_QUEUE,
+	LOGIC_FRAME_STAGE_PARTITION_MANAGER,
+	LOGIC_FRAME_STAGE_DESTROY_LIST,
+
+	LOGIC_FRAME_STAGE_COUNT
+};
+
+class LogicFrameProfile
+{
+public:
+	LogicFrameProfile();
+	~LogicFrameProfile();
+
+	Bool open(const char* filename); ///< Opens the CSV file and writes the header line
+	void close();
+	Bool isOpen() const { return m_file != nullptr; }
+
+	void beginFrame(UnsignedInt frame);
+	void endFrame(UnsignedInt objectCount, UnsignedInt sleepyUpdateCount);
+
+	void startStage(LogicFrameStage stage);
+	void stopStage(LogicFrameStage stage);
+
+	static const char* getStageName(LogicFrameStage stage);
+
+private:
+	Int64 getTicks() const;
+	UnsignedInt toMicroseconds(Int64 ticks) const;
+
+	FILE* m_file;
+	Int64 m_freq;
+	Int64 m_frameStart;
+	Int64 m_stageStart[LOGIC_FRAME_STAGE_COUNT];
+	Int64 m_stageTime[LOGIC_FRAME_STAGE_COUNT];
+	UnsignedInt m_frame;
+};
+
+// Scoped stage timer that costs only a null check when no profile is recorded.
+class LogicFrameStageTimer
+{
+public:
+	LogicFrameStageTimer(LogicFrameStage stage);
+	~LogicFrameStageTimer();
+
+private:
+	LogicFrameStage m_stage;
+};
+
+#define USE_LOGIC_FRAME_STAGE(stage) LogicFrameStageTimer logicFrameStageTimer_##stage(stage);
+
+extern LogicFrameProfile* TheLogicFrameProfile; ///< Only exists while a profile is recorded
+
+inline LogicFrameStageTimer::LogicFrameStageTimer(LogicFrameStage stage) : m_stage(stage)
+{
+	if (TheLogicFrameProfile != nullptr)
+		TheLogicFrameProfile->startStage(m_stage);
+}
+
+inline LogicFrameStageTimer::~LogicFrameStageTimer()
+{
+	if (TheLogicFrameProfile != nullptr)
+		TheLogicFrameProfile->stopStage(m_stage);
+}
@@ -0,0 +1,46 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/LocalFile.h"
+#include "Common/RAMFile.h"
+
+// TheSuperHackers @performance 18/10/2026
+// A file in an archive that reads its contents straight from a read only mapping of the archive instead of
+// copying them to the heap first. Only the part of the archive that holds the file is mapped, and only while
+// the file is open, because mapping whole archives would use up the address space of the 32 bit game.
+// Files that are too small to be worth a mapping, or that cannot be mapped, are copied like in a RAMFile.
+class MappedArchiveFile : public RAMFile
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(MappedArchiveFile, "MappedArchiveFile")
+
+public:
+	MappedArchiveFile();
+	//virtual ~MappedArchiveFile();
+
+	virtual void close() override;
+	virtual char* readEntireAndClose() override; ///< copies the contents when they are mapped, because the caller owns the buffer
+
+	Bool openFromLocalArchive(LocalFile *archiveFile, const AsciiString& filename, Int offset, Int size); ///< maps the file data at the given offset for the given size
+
+protected:
+	void unmap();
+
+	LocalFileView m_view;
+};
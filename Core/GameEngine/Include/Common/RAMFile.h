@@ -113,6 +113,7 @@ class RAMFile : public File
 		*/
 		virtual char* readEntireAndClose() override;
 		virtual File* convertToRAMFile() override;
+		virtual const char* getEntireContents() override;
 
 	protected:
 
@@ -35,6 +35,10 @@ extern void InitRandom( UnsignedInt seed );
 extern UnsignedInt GetGameLogicRandomSeed();   ///< Get the seed (used for replays)
 extern UnsignedInt GetGameLogicRandomSeedCRC();///< Get the seed (used for CRCs)
 
+enum { GAME_LOGIC_RANDOM_STATE_SIZE = 6 };
+extern void GetGameLogicRandomState(UnsignedInt (&state)[GAME_LOGIC_RANDOM_STATE_SIZE], UnsignedInt &baseSeed); ///< Get the full generator state (used for replay snapshots)
+extern void SetGameLogicRandomState(const UnsignedInt (&state)[GAME_LOGIC_RANDOM_STATE_SIZE], UnsignedInt baseSeed); ///< Restore the full generator state (used for replay snapshots)
+
 struct RandomValueClass
 {
 	virtual Int GetRandomValueInt( Int lo, Int hi, const char *file, Int line ) const = 0;
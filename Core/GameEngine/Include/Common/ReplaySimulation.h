@@ -26,7 +26,7 @@ public:
 	// Simulate a list of replays without graphics.
 	// Returns exit code 1 if mismatch or other error occurred
 	// Returns exit code 0 if all replays were successfully simulated without mismatches
-	static int simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses);
+	static int simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerJob);
 
 	static void stop() { s_isRunning = false; }
 
@@ -36,8 +36,8 @@ public:
 
 private:
 
-	static int simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames);
-	static int simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses);
+	static int simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames, Bool isBatchWorker);
+	static int simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerJob);
 	static std::vector<AsciiString> resolveFilenameWildcards(const std::vector<AsciiString> &filenames);
 
 private:
@@ -0,0 +1,72 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class WorkerThread;
+
+// Work that can be split into independent indices. runJob may be called from any thread of the pool,
+// so it must only read shared state and only write to the output slot of its own index.
+class WorkerThreadJob
+{
+public:
+	virtual ~WorkerThreadJob() {}
+	virtual void runJob(Int index) = 0;
+};
+
+// TheSuperHackers @performance 18/10/2026
+// A small pool of threads to split up work within a logic frame. run() hands out the indices of a job to
+// the worker threads and to the calling thread, and returns once all indices are done. Which thread runs
+// which index is not deterministic, so the caller must merge the results in index order. The worker
+// threads use the same FPU mode as the game logic, so floating point results do not depend on the thread.
+class WorkerThreadPool
+{
+public:
+	enum { MAX_WORKER_THREADS = 7 };
+
+	WorkerThreadPool();
+	~WorkerThreadPool();
+
+	void init(Int numThreads); ///< Starts the worker threads. 0 means run() does all work on the calling thread
+	void shutdown();
+
+	Int getNumThreads() const { return m_numThreads; }
+
+	void run(WorkerThreadJob *job, Int count); ///< Calls job->runJob(i) for all i in [0, count)
+
+	static Int getDefaultNumThreads(); ///< One thread less than there are processors, the calling thread is the last one
+
+private:
+	friend class WorkerThread;
+
+	void workerLoop(Int threadIndex);
+	void runIndices();
+
+	WorkerThread *m_threads[MAX_WORKER_THREADS];
+	HANDLE m_startEvents[MAX_WORKER_THREADS];
+	HANDLE m_doneEvent;
+	WorkerThreadJob *m_job;
+	Int m_count;
+	volatile LONG m_nextIndex;
+	volatile LONG m_busyThreads;
+	volatile Bool m_quit;
+	Bool m_isRunning;
+	Int m_numThreads;
+};
+
+extern WorkerThreadPool *TheWorkerThreadPool;
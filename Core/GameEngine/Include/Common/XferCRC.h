@@ -54,14 +54,26 @@ public:
 
 	virtual void xferSnapshot( Snapshot *snapshot ) override;		///< entry point for xfering a snapshot
 
+	// TheSuperHackers @performance 18/10/2026 The most common fixed size values go straight into the CRC,
+	// without the second virtual call to xferImplementation and its handling of partial words.
+	virtual void xferBool( Bool *boolData ) override;
+	virtual void xferInt( Int *intData ) override;
+	virtual void xferUnsignedInt( UnsignedInt *unsignedIntData ) override;
+	virtual void xferReal( Real *realData ) override;
+	virtual void xferCoord3D( Coord3D *coord3D ) override;
+	virtual void xferObjectID( ObjectID *objectID ) override;
+
 	// Xfer CRC methods
 	virtual UnsignedInt getCRC();										///< get computed CRC in network byte order
 
+	static UnsignedInt calcSnapshotCRC( Snapshot *snapshot );	///< CRC of a single snapshot on its own, in network byte order
+
 protected:
 
 	virtual void xferImplementation( void *data, Int dataSize ) override;
 
 	inline void addCRC( UnsignedInt val );								///< CRC a 4-byte block
+	void addCRCWords( const UnsignedInt *words, Int count );	///< CRC a run of 4-byte blocks
 
 	UnsignedInt m_crc;
 
@@ -55,6 +55,14 @@ public:
 	virtual void xferAsciiString( AsciiString *asciiStringData ) override;  ///< xfer ascii string (need our own)
 	virtual void xferUnicodeString( UnicodeString *unicodeStringData ) override;	///< xfer unicode string (need our own);
 
+	// these must reach xferImplementation to be written to the file, unlike in XferCRC
+	virtual void xferBool( Bool *boolData ) override { Xfer::xferBool( boolData ); }
+	virtual void xferInt( Int *intData ) override { Xfer::xferInt( intData ); }
+	virtual void xferUnsignedInt( UnsignedInt *unsignedIntData ) override { Xfer::xferUnsignedInt( unsignedIntData ); }
+	virtual void xferReal( Real *realData ) override { Xfer::xferReal( realData ); }
+	virtual void xferCoord3D( Coord3D *coord3D ) override { Xfer::xferCoord3D( coord3D ); }
+	virtual void xferObjectID( ObjectID *objectID ) override { Xfer::xferObjectID( objectID ); }
+
 protected:
 
 	virtual void xferImplementation( void *data, Int dataSize ) override;
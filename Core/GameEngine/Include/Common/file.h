@@ -209,6 +209,10 @@ class File : public MemoryPoolObject
 		*/
 		virtual char* readEntireAndClose() = 0;
 		virtual File* convertToRAMFile() = 0;
+
+		// TheSuperHackers @performance 18/10/2026 Returns the contents of the file without copying them if it holds
+		// all of them in memory, or null otherwise. The contents are only valid until the file is closed.
+		virtual const char* getEntireContents() { return nullptr; }
 };
 
 
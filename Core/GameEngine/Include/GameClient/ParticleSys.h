@@ -164,6 +164,22 @@ protected:
 };
 
 
+// TheSuperHackers @performance 18/10/2026
+// The values that are the same for all particles of a system during one update. ParticleSystem::update
+// gathers them once, so that each particle no longer asks its system for them, nor looks up the object
+// or drawable the system is attached to for its wind motion.
+struct ParticleUpdateInfo
+{
+	Coord3D m_driftVel;													///< drift velocity of the system
+	Real m_gravity;															///< acceleration along Z applied to every particle
+	UnsignedInt m_frame;												///< current client frame
+	Bool m_updateAlpha;													///< false for additive systems, whose particles keep their alpha
+	Bool m_doWindMotion;												///< true if the system has wind motion
+	Coord3D m_windPos;													///< position the wind blows from, only set with wind motion
+	Real m_windCos;															///< cosine of the wind angle, only set with wind motion
+	Real m_windSin;															///< sine of the wind angle, only set with wind motion
+};
+
 /**
  * An individual particle created by a ParticleSystem.
  * NOTE: Particles cannot exist without a parent particle system.
@@ -178,8 +194,8 @@ public:
 
 	Particle( ParticleSystem *system, const ParticleInfo *data );
 
-	Bool update();												///< update this particle's behavior - return false if dead
-	void doWindMotion();									///< do wind motion (if present) from particle system
+	Bool update( const ParticleUpdateInfo &info );		///< update this particle's behavior - return false if dead
+	void doWindMotion( const ParticleUpdateInfo &info );	///< do wind motion (if present) from particle system
 
 	void applyForce( const Coord3D *force );		///< add the given acceleration
 
@@ -191,6 +207,7 @@ public:
 	void setColor( RGBColor *color ) { m_color = *color; }
 
 	Bool isInvisible();										///< return true if this particle is invisible
+	Bool isDead() const { return m_isDead; }	///< return true if the last update found this particle dead
 	Bool isCulled () {return m_isCulled;}				///< return true if the particle falls off the edge of the screen
 	void setIsCulled (Bool enable) { m_isCulled = enable;}		///< set particle to not visible because it's outside view frustum
 
@@ -240,6 +257,7 @@ protected:
 
 
 	Bool							m_isCulled;														///< status of particle relative to screen bounds
+	Bool							m_isDead;															///< set by ParticleSystem::updateParticles, deleted by ParticleSystem::endUpdate
 public:
 	Bool							m_inSystemList;
 	Bool							m_inOverallList;
@@ -578,6 +596,18 @@ public:
 
 	virtual Bool update( Int localPlayerIndex );								///< update this particle system, return false if dead
 	void updateWindMotion();							///< update wind motion
+	void getParticleUpdateInfo( ParticleUpdateInfo *info );	///< gather the values all particles use in their update
+
+	// TheSuperHackers @performance 18/10/2026
+	// update() in three steps, so that ParticleSystemManager can move the particles of several systems on
+	// TheWorkerThreadPool between beginUpdate() and endUpdate(). updateParticles() only writes to the
+	// particles of this system and does not delete any, which is left to endUpdate().
+	Bool beginUpdate( Int localPlayerIndex, Bool *isAlive );	///< emit particles, return false if the particles do not update this frame
+	void updateParticles( const ParticleUpdateInfo &info );	///< move the particles and mark the dead ones
+	Bool endUpdate();										///< delete the dead particles, return false if the system is dead
+	Bool canUpdateParticlesConcurrently() const;	///< true if moving the particles does not affect other systems
+	void friend_setUpdatedConcurrently( Bool set ) { m_isUpdatedConcurrently = set; }	///< for use ONLY by ParticleSystemManager::update
+	Bool friend_isUpdatedConcurrently() const { return m_isUpdatedConcurrently; }
 
 	void setControlParticle( Particle *p );			///< set control particle
 
@@ -724,6 +754,7 @@ protected:
 	Bool							m_isFirstPos;													///< true if this system hasn't been drawn before.
 	Bool							m_isSaveable;													///< true if this system should be saved/loaded
 	Bool							m_skipParentXfrm;											///< true if this system is already in world space.
+	Bool							m_isUpdatedConcurrently;							///< true if ParticleSystemManager::update already updated this system this frame
 
 
 	// the actual particle system data is inherited from ParticleSystemInfo
@@ -746,6 +777,14 @@ public:
 	typedef std::hash_map<ParticleSystemID, ParticleSystem *, rts::hash<ParticleSystemID>, rts::equal_to<ParticleSystemID>/**/> ParticleSystemIDMap;
 	typedef std::hash_map<AsciiString, ParticleSystemTemplate *, rts::hash<AsciiString>, rts::equal_to<AsciiString>/**/> TemplateMap;
 
+	struct ConcurrentParticleUpdate
+	{
+		ParticleSystem *m_system;
+		ParticleUpdateInfo m_info;
+	};
+
+	enum { MIN_PARTICLES_FOR_WORKER_THREADS = 2000 };	///< below this, handing out the work costs more than it saves
+
 	ParticleSystemManager();
 	virtual ~ParticleSystemManager() override;
 
@@ -834,6 +873,7 @@ protected:
 	Int m_onScreenParticleCount;                ///< number of particles displayed on screen per frame
 	UnsignedInt m_lastLogicFrameUpdate;
 	Int m_localPlayerIndex;	///<used to tell particle systems which particles can be skipped due to player shroud status
+	std::vector<ConcurrentParticleUpdate> m_concurrentUpdates;	///< systems whose particles are moved on TheWorkerThreadPool this frame
 
 private:
 	TemplateMap m_templateMap;		///< a hash map of all particle system templates
@@ -872,6 +912,17 @@ protected:
 	virtual void loadPostProcess() override {}
 };
 
+// TheSuperHackers @performance 18/10/2026
+// ParticleSystemManager that simulates the particle systems, but does not render them. Used by -replayParticles
+// in Headless Mode to benchmark the particle system update without a GPU.
+class ParticleSystemManagerHeadless : public ParticleSystemManager
+{
+public:
+	virtual Int getOnScreenParticleCount() override { return 0; }
+	virtual void doParticles(RenderInfoClass &rinfo) override {}
+	virtual void queueParticleRender() override {}
+};
+
 /// The particle system manager singleton
 extern ParticleSystemManager *TheParticleSystemManager;
 
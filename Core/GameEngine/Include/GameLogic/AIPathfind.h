@@ -211,6 +211,7 @@ enum {MAX_WALL_PIECES = 128};
 class PathfindCellInfo
 {
 	friend class PathfindCell;
+	friend class PathfindCellList;
 public:
 #if RETAIL_COMPATIBLE_PATHFINDING
 	static void forceCleanPathFindCellInfos();
@@ -249,6 +250,9 @@ protected:
 	/// @todo Do we need both mark values in this cell?  Can't store a single value and compare it?
 	UnsignedInt m_open:1;													///< place for marking this cell as on the open list
 	UnsignedInt m_closed:1;												///< place for marking this cell as on the closed list
+
+	Int m_openHeapIndex;													///< index in the open list heap, while on it.
+	UnsignedInt m_openSequence;										///< open list insertion order, breaks total cost ties in the heap.
 };
 
 // TheSuperHackers @info The PathfindCellList class acts as a new management class for the pathfindcell open and closed lists
@@ -257,12 +261,12 @@ class PathfindCellList
 	friend class PathfindCell;
 
 public:
-	PathfindCellList() : m_head(nullptr), m_tail(nullptr) {}
+	PathfindCellList() : m_head(nullptr), m_tail(nullptr), m_openSequence(0) {}
 
 #if RETAIL_COMPATIBLE_PATHFINDING
-	void reset(PathfindCell* newHead = nullptr) { m_head = newHead; m_tail = nullptr; }
+	void reset(PathfindCell* newHead = nullptr) { m_head = newHead; m_tail = nullptr; m_openHeap.clear(); m_openSequence = 0; }
 #else
-	void reset() { m_head = nullptr; m_tail = nullptr; }
+	void reset() { m_head = nullptr; m_tail = nullptr; m_openHeap.clear(); m_openSequence = 0; }
 #endif
 
 	PathfindCell* getHead() const { return m_head; }
@@ -271,9 +275,24 @@ public:
 
 	Bool canReverseSort(PathfindCell& currentCell) const;
 
+	Int getOpenHeapSize() const { return (Int)m_openHeap.size(); }
+	PathfindCell* getOpenHeapCell(Int index) const;
+
 private:
+	// TheSuperHackers @performance 18/10/2026 The fixed pathfinding keeps the open list in a binary heap
+	// ordered by total cost, then by insertion order. This pops cells in the same order as the sorted
+	// linked list did, with O(log n) instead of O(n) insertion. m_head always refers to the heap top.
+	static Bool isOpenHeapLess(const PathfindCellInfo* a, const PathfindCellInfo* b);
+	void pushOpenHeap(PathfindCellInfo* info);
+	void removeOpenHeap(PathfindCellInfo* info);
+	void siftUpOpenHeap(Int index);
+	void siftDownOpenHeap(Int index);
+	void setOpenHeapAt(Int index, PathfindCellInfo* info);
+
 	PathfindCell* m_head;
 	PathfindCell* m_tail;
+	std::vector<PathfindCellInfo*> m_openHeap;
+	UnsignedInt m_openSequence;
 };
 
 /**
@@ -520,10 +539,38 @@ public:
 	Bool getInteractsWithBridge() const {return m_interactsWithBridge;}
 	void setInteractsWithBridge(Bool interacts) {m_interactsWithBridge = interacts;}
 
+	zoneStorageType getFirstZone() const {return m_firstZone;}
+	void offsetZones(Int delta);	///< Shifts the zones of this block without recalculating them.
+
 protected:
 	void allocateZones();
 	void freeZones();
 
+	friend class PathfindZoneManager;
+
+	// TheSuperHackers @performance 18/10/2026 Zone links are the cached adjacencies between the zones of
+	// this block, its left and top neighbor blocks and the bridge layers. They are only rebuilt when the
+	// cells of this block or its neighbors change, so the zone manager does not need to rescan the map.
+	enum ZoneLinkType CPP_11(: UnsignedByte)
+	{
+		ZONE_LINK_INTERNAL,
+		ZONE_LINK_LEFT,
+		ZONE_LINK_TOP,
+		ZONE_LINK_LAYER
+	};
+
+	struct ZoneLink
+	{
+		UnsignedByte m_zone;					///< Block local zone in this block.
+		UnsignedByte m_otherZone;			///< Block local zone in the linked block, or the linked layer.
+		UnsignedByte m_linkType;			///< ZoneLinkType
+		UnsignedByte m_equivalences;	///< Zone equivalency tables that join the two zones.
+	};
+
+	typedef std::vector<ZoneLink> ZoneLinkVector;
+
+	void addZoneLink(Int zone, Int otherZone, ZoneLinkType linkType, UnsignedByte equivalences);
+
 protected:
 	ICoord2D		m_cellOrigin;
 
@@ -538,6 +585,12 @@ protected:
 	zoneStorageType *m_crusherZones;
 	Bool					m_interactsWithBridge;
 	Bool					m_markedPassable;
+
+	ZoneLinkVector	m_zoneLinks;
+	UnsignedShort		m_numLocalZones;						///< Number of zones local to this block, from the last calculation.
+	Bool						m_cellsInteractWithBridge;	///< True if any cell of this block connects to a bridge layer.
+	Bool						m_localZonesChanged;				///< True if the local zones were recalculated in this calculation.
+	Bool						m_zoneLinksDirty;						///< True if the zone links need to be rebuilt.
 };
 typedef ZoneBlock *ZoneBlockP;
 
@@ -589,11 +642,22 @@ private:
 	void freeZones();
 	void freeBlocks();
 
+	void getBlockBounds(Int xBlock, Int yBlock, const IRegion2D &globalBounds, IRegion2D &bounds) const;
+	Int getCellIndex(Int cellX, Int cellY) const {return (cellX-m_cellBounds.lo.x)*(m_cellBounds.hi.y-m_cellBounds.lo.y+1) + cellY-m_cellBounds.lo.y;}
+	Bool updateCellZoneInputs(PathfindCell **map, const IRegion2D &bounds);
+	void calculateLocalZones(PathfindCell **map, const IRegion2D &bounds, ZoneBlock &block);
+	void calculateZoneLinks(PathfindCell **map, const IRegion2D &bounds, const IRegion2D &globalBounds, ZoneBlock &block);
+	void applyZoneLinks(PathfindLayer layers[], Int xBlock, Int yBlock);
+
 private:
 	ZoneBlock			*m_blockOfZoneBlocks;			///< Zone blocks - Info for hierarchical pathfinding at a "blocky" level.
 	ZoneBlock			**m_zoneBlocks;						///< Zone blocks as a matrix - contains matrix indexing into the map.
 	ICoord2D			m_zoneBlockExtent;				///< Zone block extents. Not the same scale as the pathfind extents.
 
+	IRegion2D			m_cellBounds;							///< Cell bounds the zone blocks were allocated for.
+	UnsignedByte	*m_cellZoneInputs;				///< Per cell state that the zones depend on, from the last calculation.
+	UnsignedByte	*m_cellLocalZones;				///< Per cell zone, local to the zone block of the cell.
+
 	UnsignedShort m_maxZone;								///< Max zone used.
 	UnsignedInt		m_nextFrameToCalculateZones;		///< When should I recalculate, next?.
 	UnsignedShort m_zonesAllocated;
@@ -922,6 +986,7 @@ private:
 	Int						m_queuePRHead;
 	Int						m_queuePRTail;
 	Int						m_cumulativeCellsAllocated;
+	Int						m_queueCellDebt;	///< Cells examined beyond the budget of earlier frames, see TAiData::m_pathfindCarryOverCells
 
 #if RTS_ZEROHOUR && RETAIL_COMPATIBLE_CRC
 public:
@@ -0,0 +1,82 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/GameCommon.h"
+
+class Path;
+
+// TheSuperHackers @feature 18/10/2026
+// Records every request processed by the pathfind queue and writes one CSV line per request.
+// It is enabled with -replayPathfindProfile during replay simulation and writes "<replay>.pathfind.csv"
+// next to each simulated replay. A replay is a reproducible, headless pathfinding workload, so two
+// builds can be compared by their request latencies and by the hashes of the paths they found.
+enum PathfindRequestKind CPP_11(: Int)
+{
+	PATHFIND_REQUEST_FIND_PATH					= 0x01,
+	PATHFIND_REQUEST_FIND_CLOSEST_PATH	= 0x02,
+	PATHFIND_REQUEST_FIND_ATTACK_PATH		= 0x04,
+	PATHFIND_REQUEST_FIND_SAFE_PATH			= 0x08,
+};
+
+class PathfindRequestProfile
+{
+public:
+	PathfindRequestProfile();
+	~PathfindRequestProfile();
+
+	Bool open(const char* filename); ///< Opens the CSV file and writes the header line
+	void close();
+	Bool isOpen() const { return m_file != nullptr; }
+
+	void beginRequest(UnsignedInt frame, ObjectID objectID, UnsignedInt surfaces, Int diameter, Bool crusher,
+		const Coord3D& from, Int fromLayer, const Coord3D& to);
+	void addRequestKind(PathfindRequestKind kind) { m_requestKinds |= kind; }
+	void endRequest(Path* path, Int cellsExamined);
+
+	void printSummary() const; ///< Prints latency percentiles and the combined path hash to stdout
+
+private:
+	Int64 getTicks() const;
+	UnsignedInt toMicroseconds(Int64 ticks) const;
+	static UnsignedInt hashPath(Path* path, Int& nodeCount);
+
+	struct Request
+	{
+		UnsignedInt frame;
+		ObjectID objectID;
+		UnsignedInt surfaces;
+		Int diameter;
+		Bool crusher;
+		Coord3D from;
+		Int fromLayer;
+		Coord3D to;
+	};
+
+	FILE* m_file;
+	Int64 m_freq;
+	Int64 m_requestStart;
+	Request m_request;
+	UnsignedInt m_requestKinds;
+	UnsignedInt m_combinedHash;
+	UnsignedInt m_totalCells;
+	std::vector<UnsignedInt> m_latencies;
+};
+
+extern PathfindRequestProfile* ThePathfindRequestProfile; ///< Only exists while a profile is recorded
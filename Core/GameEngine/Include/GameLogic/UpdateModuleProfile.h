@@ -0,0 +1,91 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/GameCommon.h"
+#include "Common/NameKeyGenerator.h"
+#include "Common/STLTypedefs.h"
+
+class DebugDisplayInterface;
+class ThingTemplate;
+
+// TheSuperHackers @feature 18/10/2026
+// Adds up the calls to the sleepy update modules per module class and per ThingTemplate: the number of
+// calls, the total and longest time spent in update() and the sleep each call asked for. It is enabled with
+// -replayUpdateProfile during replay simulation and writes "<replay>.updates.csv" next to each simulated
+// replay. In game, DEBUG_SLEEPY_UPDATE_PERFORMANCE toggles it on the debug display.
+// It only reads the performance counter, so it does not change the game logic.
+class UpdateModuleProfile
+{
+public:
+	UpdateModuleProfile();
+
+	void reset();
+
+	Int64 getTicks() const;
+	void addCall(NameKeyType moduleNameKey, const ThingTemplate* thingTemplate, Int64 ticks, UnsignedInt sleepFrames);
+
+	Bool writeCSV(const char* filename) const;	///< Writes all module classes and then all templates, each by descending total time
+	void printSummary(Int count) const;					///< Prints the module classes with the highest total time to stdout
+	void debugDisplay(DebugDisplayInterface* dd, Int count) const;
+
+private:
+	struct Stats
+	{
+		Stats();
+		void add(Int64 ticks, UnsignedInt sleepFrames);
+		UnsignedInt getAverageSleepFrames() const;	///< average of the sleeps that were not forever
+
+		UnsignedInt m_calls;
+		Int64 m_totalTicks;
+		Int64 m_maxTicks;
+		UnsignedInt64 m_sleepFrames;			///< sum of the sleeps that were not forever
+		UnsignedInt m_sleepForeverCalls;	///< number of calls that went to sleep forever
+	};
+
+	struct TemplateStats
+	{
+		AsciiString m_name;
+		Stats m_stats;
+	};
+
+	struct Entry
+	{
+		AsciiString m_name;
+		const Stats* m_stats;
+	};
+
+	typedef std::hash_map<NameKeyType, Stats, rts::hash<NameKeyType>, rts::equal_to<NameKeyType> > ModuleStatsMap;
+	typedef std::hash_map<UnsignedShort, TemplateStats, rts::hash<UnsignedShort>, rts::equal_to<UnsignedShort> > TemplateStatsMap;
+
+	static Bool isHigherTotal(const Entry& a, const Entry& b);
+	void getModuleEntries(std::vector<Entry>& entries) const;
+	void getTemplateEntries(std::vector<Entry>& entries) const;
+	UnsignedInt64 toTime(Int64 ticks, Int64 unitsPerSecond) const;
+	UnsignedInt64 toMicroseconds(Int64 ticks) const { return toTime(ticks, 1000000); }
+	UnsignedInt64 toNanoseconds(Int64 ticks) const { return toTime(ticks, 1000000000); }
+
+	Int64 m_freq;
+	ModuleStatsMap m_modules;
+	TemplateStatsMap m_templates;
+};
+
+extern UpdateModuleProfile* TheUpdateModuleProfile; ///< Only exists while a profile is recorded
+
+extern void UpdateModuleProfileDebugDisplay(DebugDisplayInterface* dd, void*, FILE* fp = nullptr);
@@ -463,6 +463,89 @@ Int parseJobs(char *args[], int num)
 	return 1;
 }
 
+Int parseReplaysPerJob(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaysPerJob = atoi(args[1]);
+		if (TheGlobalData->m_simulateReplaysPerJob < 1 || TheGlobalData->m_simulateReplaysPerJob > SIMULATE_REPLAYS_MAX_PER_JOB)
+		{
+			printf("Invalid number of replays per job: %d\n", TheGlobalData->m_simulateReplaysPerJob);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplayBatchWorker(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayBatchWorker = TRUE;
+	return 1;
+}
+
+Int parseReplayProfile(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayProfile = TRUE;
+	return 1;
+}
+
+Int parseReplayPathfindProfile(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayPathfindProfile = TRUE;
+	return 1;
+}
+
+Int parseReplayUpdateProfile(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayUpdateProfile = TRUE;
+	return 1;
+}
+
+Int parseReplayMemoryPools(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayMemoryPools = TRUE;
+	return 1;
+}
+
+Int parseReplayFrameCRC(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayFrameCRC = TRUE;
+	return 1;
+}
+
+Int parseReplayParticles(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayParticles = TRUE;
+	return 1;
+}
+
+Int parseReplaySnapshotInterval(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_replaySnapshotInterval = max(atoi(args[1]), 0);
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplayResumeFrame(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_replayResumeFrame = max(atoi(args[1]), 0);
+		return 2;
+	}
+	return 1;
+}
+
+Int parseINICache(char *args[], int num)
+{
+	TheWritableGlobalData->m_useINICache = TRUE;
+	return 1;
+}
+
 Int parseXRes(char *args[], int num)
 {
 	if (num > 1)
@@ -1141,6 +1224,68 @@ static CommandLineParam paramsForStartup[] =
 	// (If you have 4 cores, call it with -jobs 4)
 	// If you do not call this, all replays will be simulated in sequence in the same process.
 	{ "-jobs", parseJobs },
+
+	// TheSuperHackers @performance 18/10/2026
+	// Simulate up to N replays (1..30) in sequence in each process started with -jobs, so that the engine
+	// startup is paid once per N replays instead of once per replay. The output and the exit code stay the same.
+	{ "-replaysPerJob", parseReplaysPerJob },
+
+	// TheSuperHackers @info 18/10/2026
+	// Internal. Passed by -jobs to the worker processes, which then return a bit mask of the failed replays
+	// as exit code and leave the summary and the tuned memory pools to the parent process.
+	{ "-replayBatchWorker", parseReplayBatchWorker },
+
+	// TheSuperHackers @feature 18/10/2026
+	// Write the time of each GameLogic::update stage per logic frame to "<replay>.frames.csv" next to each
+	// simulated replay. Requires -headless. Useful to compare the performance of builds with the test replays.
+	{ "-replayProfile", parseReplayProfile },
+
+	// TheSuperHackers @feature 18/10/2026
+	// Write every processed pathfind request with its time and a hash of the found path to
+	// "<replay>.pathfind.csv" next to each simulated replay. Requires -headless. Prints latency
+	// percentiles and a combined path hash per replay, to compare pathfinder changes for speed and equality.
+	{ "-replayPathfindProfile", parseReplayPathfindProfile },
+
+	// TheSuperHackers @feature 18/10/2026
+	// Add up the time spent in the sleepy update modules per module class and per object template and
+	// write it to "<replay>.updates.csv" next to each simulated replay. Requires -headless. Prints the
+	// most expensive module classes per replay.
+	{ "-replayUpdateProfile", parseReplayUpdateProfile },
+
+	// TheSuperHackers @feature 18/10/2026
+	// Write the block counts, the peak usage and the number of overflow blobs of each memory pool to
+	// "<replay>.pools.csv" next to each simulated replay. Requires -headless. After all replays are done,
+	// "MemoryPools.tuned.ini" is written to the replay folder with initial pool sizes taken from the highest
+	// peaks. It has the format of Data\INI\MemoryPools.ini, which overrides the built-in pool sizes.
+	{ "-replayMemoryPools", parseReplayMemoryPools },
+
+	// TheSuperHackers @feature 18/10/2026
+	// Write the incremental logic CRC of every frame to "<replay>.crc.csv" next to each simulated replay.
+	// Requires -headless. Diffing the files of two builds shows the first frame on which the logic differs,
+	// instead of only the next CRC interval that the replay recorded.
+	{ "-replayFrameCRC", parseReplayFrameCRC },
+
+	// TheSuperHackers @performance 18/10/2026
+	// Simulate the particle systems without rendering them and update them after every logic frame of each
+	// simulated replay. Requires -headless. Prints the time spent in the particle system update and the highest
+	// particle count per replay, to benchmark the particle system update without a GPU.
+	{ "-replayParticles", parseReplayParticles },
+
+	// TheSuperHackers @feature 18/10/2026
+	// Save a snapshot of the game every N frames while a replay is played back. The snapshots are written to
+	// the "ReplaySnapshots" folder in the save directory and can be resumed from with -replayResumeFrame.
+	{ "-replaySnapshotInterval", parseReplaySnapshotInterval },
+
+	// TheSuperHackers @feature 18/10/2026
+	// Start the simulation of each replay from its latest snapshot at or before the given frame, instead of
+	// from the start. Falls back to the start of the replay if there is no snapshot. A snapshot that cannot
+	// be loaded fails the replay.
+	{ "-replayResumeFrame", parseReplayResumeFrame },
+
+	// TheSuperHackers @performance 18/10/2026
+	// Keep the preprocessed lines of the INI files in "INICache.dat" in the user data folder and load the INI
+	// files from there on the next start, as long as their size and time stamp did not change.
+	{ "-iniCache", parseINICache },
 };
 
 // These Params are parsed during Engine Init before INI data is loaded
@@ -38,6 +38,7 @@
 #include "Common/file.h"
 #include "Common/FileSystem.h"
 #include "Common/GameAudio.h"
+#include "Common/INICache.h"
 #include "Common/Science.h"
 #include "Common/SpecialPower.h"
 #include "Common/ThingFactory.h"
@@ -181,8 +182,15 @@ INI::INI()
 {
 
 	m_readBuffer = nullptr;
+	m_readFile = nullptr;
 	m_readBufferNext = 0;
 	m_readBufferUsed = 0;
+	m_cachedLine = nullptr;
+	m_cachedLinesLeft = 0;
+	m_recordingLines = FALSE;
+	m_recordedLineCount = 0;
+	m_fileSize = 0;
+	m_fileTimestamp = 0;
 	m_filename					= "None";
 	m_loadType					= INI_LOAD_INVALID;
 	m_lineNum						= 0;
@@ -288,7 +296,7 @@ UnsignedInt INI::loadDirectory( AsciiString dirName, INILoadType loadType, Xfer
 void INI::prepFile( AsciiString filename, INILoadType loadType )
 {
 	// if we have a file open already -- we can't do another one
-	if( m_readBuffer != nullptr )
+	if( m_readBuffer != nullptr || m_cachedLine != nullptr )
 	{
 
 		DEBUG_CRASH(( "INI::load, cannot open file '%s', file already open", filename.str() ));
@@ -296,6 +304,27 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 
 	}
 
+	// TheSuperHackers @performance 18/10/2026 Take the lines from the INI cache if it has an up to date copy of them.
+	Bool recordLines = FALSE;
+	FileInfo fileInfo;
+	if( TheINICache != nullptr && TheFileSystem->getFileInfo(filename, &fileInfo) )
+	{
+		m_fileSize = fileInfo.size();
+		m_fileTimestamp = fileInfo.timestamp();
+
+		const INICacheEntry *entry = TheINICache->findEntry(filename, m_fileSize, m_fileTimestamp);
+		if( entry != nullptr )
+		{
+			m_cachedLine = entry->m_lines.data();
+			m_cachedLinesLeft = entry->m_lineCount;
+			m_filename = filename;
+			m_loadType = loadType;
+			return;
+		}
+
+		recordLines = TRUE;
+	}
+
 	// open the file
 	File* file = TheFileSystem->openFile(filename.str(), File::READ);
 	if( file == nullptr )
@@ -308,7 +337,15 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 
 	m_readBufferNext = 0;
 	m_readBufferUsed = file->size();
-	m_readBuffer = file->readEntireAndClose();
+
+	// TheSuperHackers @performance 18/10/2026 Read straight from the file if it already holds its contents in memory.
+	m_readBuffer = file->getEntireContents();
+	if( m_readBuffer != nullptr )
+		m_readFile = file;
+	else
+		m_readBuffer = file->readEntireAndClose();
+
+	m_recordingLines = recordLines;
 
 	// save our filename
 	m_filename = filename;
@@ -322,11 +359,25 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 void INI::unPrepFile()
 {
 	// delete the buffer
-	delete[] m_readBuffer;
+	if( m_readFile != nullptr )
+	{
+		m_readFile->close();
+		m_readFile = nullptr;
+	}
+	else
+	{
+		delete[] m_readBuffer;
+	}
 	m_readBuffer = nullptr;
 	m_readBufferNext = 0;
 	m_readBufferUsed = 0;
 
+	m_cachedLine = nullptr;
+	m_cachedLinesLeft = 0;
+	m_recordingLines = FALSE;
+	m_recordedLines.clear();
+	m_recordedLineCount = 0;
+
 	m_filename = "None";
 	m_loadType = INI_LOAD_INVALID;
 	m_lineNum = 0;
@@ -444,6 +495,11 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer,
 			}
 
 		}
+
+		if( m_recordingLines )
+		{
+			TheINICache->addEntry(m_filename, m_fileSize, m_fileTimestamp, m_recordedLineCount, m_recordedLines);
+		}
 	}
 	catch (...)
 	{
@@ -468,6 +524,12 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer,
 //-------------------------------------------------------------------------------------------------
 void INI::readLine()
 {
+	if (m_cachedLine != nullptr)
+	{
+		readCachedLine();
+		return;
+	}
+
 	// sanity
 	DEBUG_ASSERTCRASH( m_readBuffer, ("readLine(), read buffer is null") );
 
@@ -477,61 +539,148 @@ void INI::readLine()
 	}
 	else
 	{
-		// read up till the newline or semicolon character, or until out of space
-		char *p = m_buffer;
-		while (p != m_buffer+INI_MAX_CHARS_PER_LINE)
+		if (splitLine( m_readBuffer, m_readBufferUsed, m_readBufferNext, m_buffer, m_filename.str(), getLineNum() ))
 		{
-			// test end of read buffer
-			if (m_readBufferNext==m_readBufferUsed)
-			{
-				m_endOfFile = true;
-				*p = 0;
-				break;
-			}
+			m_endOfFile = true;
+		}
 
-			// get next character
-			*p = m_readBuffer[m_readBufferNext++];
+		// increase our line count
+		m_lineNum++;
 
-			// check for new line
-			if (*p == '\n')
-			{
-				*p = 0;
-				break;
-			}
+		if (m_recordingLines)
+		{
+			appendLine( m_recordedLines, m_buffer );
+			++m_recordedLineCount;
+		}
+	}
 
-			DEBUG_ASSERTCRASH(*p != '\t', ("tab characters are not allowed in INI files (%s). please check your editor settings. Line Number %d", m_filename.str(), getLineNum()));
+	if (s_xfer)
+	{
+		s_xfer->xferUser( m_buffer, sizeof( char ) * strlen( m_buffer ) );
+		//DEBUG_LOG(("Xfer val is now 0x%8.8X in %s, line %s", ((XferCRC *)s_xfer)->getCRC(), m_filename.str(), m_buffer));
+	}
+}
 
-			// if this is a semicolon, that represents the start of a comment
-			if (*p == ';')
-			{
-				*p = 0;
-			}
+//-------------------------------------------------------------------------------------------------
+/** Copy the next line of data, starting at next, into buffer. Comments are cut off and whitespace
+	* characters become spaces. Returns TRUE when the end of data was reached. This is used by readLine
+	* and preprocessLines, so that the lines of the file and the prefetched lines are the same. */
+//-------------------------------------------------------------------------------------------------
+Bool INI::splitLine( const char *data, UnsignedInt size, UnsignedInt& next, char *buffer, const char *filename, UnsignedInt lineNum )
+{
+	Bool endOfData = FALSE;
 
-			// make whitespace characters actual spaces
-			else if (*p > 0 && *p < 32)
-			{
-				*p = ' ';
-			}
+	// read up till the newline or semicolon character, or until out of space
+	char *p = buffer;
+	while (p != buffer+INI_MAX_CHARS_PER_LINE)
+	{
+		// test end of read buffer
+		if (next == size)
+		{
+			endOfData = TRUE;
+			*p = 0;
+			break;
+		}
+
+		// get next character
+		*p = data[next++];
 
-			p++;
+		// check for new line
+		if (*p == '\n')
+		{
+			*p = 0;
+			break;
 		}
 
-		*p = 0;
+		DEBUG_ASSERTCRASH(*p != '\t', ("tab characters are not allowed in INI files (%s). please check your editor settings. Line Number %d", filename, lineNum));
+
+		// if this is a semicolon, that represents the start of a comment
+		if (*p == ';')
+		{
+			*p = 0;
+		}
+
+		// make whitespace characters actual spaces
+		else if (*p > 0 && *p < 32)
+		{
+			*p = ' ';
+		}
+
+		p++;
+	}
+
+	*p = 0;
+
+	// check for at the max
+	if ( p == buffer+INI_MAX_CHARS_PER_LINE )
+	{
+		DEBUG_CRASH( ("Buffer too small (%d) and was truncated, increase INI_MAX_CHARS_PER_LINE", INI_MAX_CHARS_PER_LINE) );
+	}
+
+	return endOfData;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Append a line in the INICacheEntry layout: its length, its characters up to the first terminator
+	* and a terminating 0. Everything after the first terminator is a cut off comment that nobody reads. */
+//-------------------------------------------------------------------------------------------------
+void INI::appendLine( std::vector<char>& lines, const char *buffer )
+{
+	const UnsignedShort length = (UnsignedShort)strlen( buffer );
+	const char *lengthBytes = reinterpret_cast<const char *>(&length);
+	lines.insert( lines.end(), lengthBytes, lengthBytes + sizeof( length ) );
+	lines.insert( lines.end(), buffer, buffer + length + 1 );
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Split a whole file into lines the same way readLine does. */
+//-------------------------------------------------------------------------------------------------
+void INI::preprocessLines( const char *filename, const char *data, UnsignedInt size, std::vector<char>& lines, UnsignedInt& lineCount )
+{
+	char buffer[ INI_MAX_CHARS_PER_LINE+1 ];
+	UnsignedInt next = 0;
+	Bool endOfFile = FALSE;
+
+	lines.clear();
+	lineCount = 0;
+
+	while (!endOfFile)
+	{
+		endOfFile = splitLine( data, size, next, buffer, filename, lineCount );
+		appendLine( lines, buffer );
+		++lineCount;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Read the next line from TheINICache. The lines there are exactly the ones readLine produced from
+	* the file, so the parsing and the INI CRC do not see a difference. */
+//-------------------------------------------------------------------------------------------------
+void INI::readCachedLine()
+{
+	if (m_endOfFile)
+	{
+		*m_buffer = 0;
+	}
+	else
+	{
+		UnsignedShort length;
+		memcpy( &length, m_cachedLine, sizeof( length ) );
+		m_cachedLine += sizeof( length );
+		memcpy( m_buffer, m_cachedLine, length + 1 );
+		m_cachedLine += length + 1;
 
-		// increase our line count
 		m_lineNum++;
 
-		// check for at the max
-		if ( p == m_buffer+INI_MAX_CHARS_PER_LINE )
+		if (--m_cachedLinesLeft == 0)
 		{
-			DEBUG_CRASH( ("Buffer too small (%d) and was truncated, increase INI_MAX_CHARS_PER_LINE", INI_MAX_CHARS_PER_LINE) );
+			m_endOfFile = TRUE;
 		}
 	}
 
 	if (s_xfer)
 	{
 		s_xfer->xferUser( m_buffer, sizeof( char ) * strlen( m_buffer ) );
-		//DEBUG_LOG(("Xfer val is now 0x%8.8X in %s, line %s", ((XferCRC *)s_xfer)->getCRC(), m_filename.str(), m_buffer));
 	}
 }
 
@@ -0,0 +1,320 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "Common/INICache.h"
+
+#include "Common/file.h"
+#include "Common/FileSystem.h"
+#include "Common/INI.h"
+#include "Common/WorkerThreadPool.h"
+
+INICache *TheINICache = nullptr;
+
+// Increment when INI::readLine changes the way it turns the file contents into lines.
+static const UnsignedInt INI_CACHE_VERSION = 1;
+static const char INI_CACHE_MAGIC[4] = { 'I', 'N', 'I', 'C' };
+
+//-------------------------------------------------------------------------------------------------
+// Reads the cache file contents without ever reading past the end of them.
+class INICacheReader
+{
+public:
+	INICacheReader(const char *data, Int size) : m_data(data), m_left(size) {}
+
+	Bool read(void *dest, Int bytes)
+	{
+		if (bytes < 0 || bytes > m_left)
+			return FALSE;
+		memcpy(dest, m_data, bytes);
+		m_data += bytes;
+		m_left -= bytes;
+		return TRUE;
+	}
+
+	template <typename T>
+	Bool read(T &value) { return read(&value, sizeof(T)); }
+
+	Bool isDone() const { return m_left == 0; }
+
+private:
+	const char *m_data;
+	Int m_left;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Checks that the lines of an entry are laid out the way INI::readLine expects them.
+static Bool areLinesValid(const std::vector<char>& lines, UnsignedInt lineCount)
+{
+	size_t pos = 0;
+	for (UnsignedInt i = 0; i < lineCount; ++i)
+	{
+		UnsignedShort length;
+		if (pos + sizeof(length) > lines.size())
+			return FALSE;
+		memcpy(&length, &lines[pos], sizeof(length));
+		pos += sizeof(length);
+		if (length > INI_MAX_CHARS_PER_LINE || pos + length + 1 > lines.size() || lines[pos + length] != 0)
+			return FALSE;
+		pos += length + 1;
+	}
+	return lineCount > 0 && pos == lines.size();
+}
+
+//-------------------------------------------------------------------------------------------------
+// Splits the prefetched files into lines. Each index only writes to its own output.
+class INIPrefetchJob : public WorkerThreadJob
+{
+public:
+	struct Item
+	{
+		AsciiString m_filename;
+		Int64 m_size;
+		Int64 m_timestamp;
+		File *m_file;
+		const char *m_data;
+		UnsignedInt m_dataSize;
+		std::vector<char> m_lines;
+		UnsignedInt m_lineCount;
+	};
+
+	virtual void runJob(Int index) override
+	{
+		Item& item = m_items[index];
+		INI::preprocessLines(item.m_filename.str(), item.m_data, item.m_dataSize, item.m_lines, item.m_lineCount);
+	}
+
+	std::vector<Item> m_items;
+};
+
+//-------------------------------------------------------------------------------------------------
+INICache::INICache() :
+	m_changed(FALSE)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+INICache::~INICache()
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void INICache::load(const AsciiString& cacheFilename)
+{
+	m_cacheFilename = cacheFilename;
+	m_entries.clear();
+	m_changed = FALSE;
+
+	File *file = TheFileSystem->openFile(cacheFilename.str(), File::READ | File::BINARY);
+	if (file == nullptr)
+		return;
+
+	const Int size = file->size();
+	char *data = file->readEntireAndClose();
+
+	INICacheReader reader(data, size);
+	char magic[4];
+	UnsignedInt version;
+	UnsignedInt maxCharsPerLine;
+	UnsignedInt entryCount;
+	Bool valid = reader.read(magic, sizeof(magic))
+		&& memcmp(magic, INI_CACHE_MAGIC, sizeof(magic)) == 0
+		&& reader.read(version) && version == INI_CACHE_VERSION
+		&& reader.read(maxCharsPerLine) && maxCharsPerLine == INI_MAX_CHARS_PER_LINE
+		&& reader.read(entryCount);
+
+	for (UnsignedInt i = 0; valid && i < entryCount; ++i)
+	{
+		UnsignedShort nameLength;
+		char name[_MAX_PATH + 1];
+		UnsignedInt linesSize;
+		INICacheEntry entry;
+		entry.m_used = FALSE;
+
+		valid = reader.read(nameLength) && nameLength <= _MAX_PATH
+			&& reader.read(name, nameLength)
+			&& reader.read(entry.m_size)
+			&& reader.read(entry.m_timestamp)
+			&& reader.read(entry.m_lineCount)
+			&& reader.read(linesSize);
+		if (!valid)
+			break;
+
+		entry.m_lines.resize(linesSize);
+		valid = reader.read(entry.m_lines.data(), (Int)linesSize) && areLinesValid(entry.m_lines, entry.m_lineCount);
+		if (!valid)
+			break;
+
+		name[nameLength] = 0;
+		INICacheEntry& stored = m_entries[makeKey(AsciiString(name))];
+		stored.m_size = entry.m_size;
+		stored.m_timestamp = entry.m_timestamp;
+		stored.m_lineCount = entry.m_lineCount;
+		stored.m_lines.swap(entry.m_lines);
+		stored.m_used = FALSE;
+	}
+
+	if (!valid || !reader.isDone())
+	{
+		DEBUG_LOG(("INICache::load - ignoring outdated or broken INI cache '%s'", cacheFilename.str()));
+		m_entries.clear();
+	}
+
+	delete[] data;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INICache::save()
+{
+	if (!m_changed || m_cacheFilename.isEmpty())
+		return;
+
+	File *file = TheFileSystem->openFile(m_cacheFilename.str(), File::WRITE | File::CREATE | File::TRUNCATE | File::BINARY);
+	if (file == nullptr)
+	{
+		DEBUG_LOG(("INICache::save - cannot write INI cache '%s'", m_cacheFilename.str()));
+		return;
+	}
+
+	UnsignedInt entryCount = 0;
+	for (EntryMap::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		if (it->second.m_used)
+			++entryCount;
+	}
+
+	const UnsignedInt version = INI_CACHE_VERSION;
+	const UnsignedInt maxCharsPerLine = INI_MAX_CHARS_PER_LINE;
+	file->write(INI_CACHE_MAGIC, sizeof(INI_CACHE_MAGIC));
+	file->write(&version, sizeof(version));
+	file->write(&maxCharsPerLine, sizeof(maxCharsPerLine));
+	file->write(&entryCount, sizeof(entryCount));
+
+	// Only the files used this time are written, so that the files of a mod that is no longer played drop out.
+	for (EntryMap::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		const INICacheEntry& entry = it->second;
+		if (!entry.m_used)
+			continue;
+
+		const UnsignedShort nameLength = (UnsignedShort)it->first.getLength();
+		const UnsignedInt linesSize = (UnsignedInt)entry.m_lines.size();
+		file->write(&nameLength, sizeof(nameLength));
+		file->write(it->first.str(), nameLength);
+		file->write(&entry.m_size, sizeof(entry.m_size));
+		file->write(&entry.m_timestamp, sizeof(entry.m_timestamp));
+		file->write(&entry.m_lineCount, sizeof(entry.m_lineCount));
+		file->write(&linesSize, sizeof(linesSize));
+		file->write(entry.m_lines.data(), linesSize);
+	}
+
+	file->close();
+	m_changed = FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+const INICacheEntry *INICache::findEntry(const AsciiString& iniFilename, Int64 size, Int64 timestamp)
+{
+	EntryMap::iterator it = m_entries.find(makeKey(iniFilename));
+	if (it == m_entries.end() || it->second.m_size != size || it->second.m_timestamp != timestamp)
+		return nullptr;
+
+	it->second.m_used = TRUE;
+	return &it->second;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INICache::addEntry(const AsciiString& iniFilename, Int64 size, Int64 timestamp, UnsignedInt lineCount, const std::vector<char>& lines)
+{
+	if (iniFilename.getLength() > _MAX_PATH)
+		return;
+
+	INICacheEntry& entry = m_entries[makeKey(iniFilename)];
+	entry.m_size = size;
+	entry.m_timestamp = timestamp;
+	entry.m_lineCount = lineCount;
+	entry.m_lines = lines;
+	entry.m_used = TRUE;
+	m_changed = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INICache::prefetchDirectory(const AsciiString& dirName)
+{
+	AsciiString searchDir = dirName;
+	searchDir.concat('\\');
+
+	FilenameList filenameList;
+	TheFileSystem->getFileListInDirectory(searchDir, "*.ini", filenameList, TRUE);
+
+	INIPrefetchJob job;
+	job.m_items.reserve(filenameList.size());
+
+	for (FilenameList::const_iterator it = filenameList.begin(); it != filenameList.end(); ++it)
+	{
+		FileInfo fileInfo;
+		if (!TheFileSystem->getFileInfo(*it, &fileInfo))
+			continue;
+		if (findEntry(*it, fileInfo.size(), fileInfo.timestamp()) != nullptr)
+			continue;
+
+		File *file = TheFileSystem->openFile(it->str(), File::READ | File::BINARY);
+		if (file == nullptr)
+			continue;
+
+		job.m_items.resize(job.m_items.size() + 1);
+		INIPrefetchJob::Item& item = job.m_items.back();
+		item.m_filename = *it;
+		item.m_size = fileInfo.size();
+		item.m_timestamp = fileInfo.timestamp();
+		item.m_dataSize = file->size();
+		item.m_lineCount = 0;
+
+		// The files stay open until the job is done if they hold their contents in memory already.
+		item.m_data = file->getEntireContents();
+		if (item.m_data != nullptr)
+		{
+			item.m_file = file;
+		}
+		else
+		{
+			item.m_file = nullptr;
+			item.m_data = file->readEntireAndClose();
+		}
+	}
+
+	TheWorkerThreadPool->run(&job, (Int)job.m_items.size());
+
+	for (size_t i = 0; i < job.m_items.size(); ++i)
+	{
+		INIPrefetchJob::Item& item = job.m_items[i];
+		addEntry(item.m_filename, item.m_size, item.m_timestamp, item.m_lineCount, item.m_lines);
+		if (item.m_file != nullptr)
+			item.m_file->close();
+		else
+			delete[] item.m_data;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+AsciiString INICache::makeKey(const AsciiString& iniFilename)
+{
+	AsciiString key = iniFilename;
+	key.toLower();
+	return key;
+}
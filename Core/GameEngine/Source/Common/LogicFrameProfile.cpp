@@ -0,0 +1,129 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "Common/LogicFrameProfile.h"
+
+
+LogicFrameProfile* TheLogicFrameProfile = nullptr;
+
+static const char* const TheLogicFrameStageNames[] =
+{
+	"script_engine",
+	"terrain_logic",
+	"crc",
+	"command_list",
+	"normal_updates",
+	"sleepy_updates",
+	"ai",
+	"pathfind_queue",
+	"partition_manager",
+	"destroy_list",
+};
+static_assert(ARRAY_SIZE(TheLogicFrameStageNames) == LOGIC_FRAME_STAGE_COUNT, "Incorrect array size");
+
+LogicFrameProfile::LogicFrameProfile()
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	m_freq = freq.QuadPart;
+	m_file = nullptr;
+	m_frameStart = 0;
+	m_frame = 0;
+	for (Int i = 0; i < LOGIC_FRAME_STAGE_COUNT; ++i)
+	{
+		m_stageStart[i] = 0;
+		m_stageTime[i] = 0;
+	}
+}
+
+LogicFrameProfile::~LogicFrameProfile()
+{
+	close();
+}
+
+Bool LogicFrameProfile::open(const char* filename)
+{
+	close();
+	m_file = fopen(filename, "wt");
+	if (m_file == nullptr)
+		return FALSE;
+
+	fprintf(m_file, "frame,total_us");
+	for (Int i = 0; i < LOGIC_FRAME_STAGE_COUNT; ++i)
+		fprintf(m_file, ",%s_us", TheLogicFrameStageNames[i]);
+	fprintf(m_file, ",objects,sleepy_updates\n");
+	return TRUE;
+}
+
+void LogicFrameProfile::close()
+{
+	if (m_file != nullptr)
+	{
+		fclose(m_file);
+		m_file = nullptr;
+	}
+}
+
+const char* LogicFrameProfile::getStageName(LogicFrameStage stage)
+{
+	return TheLogicFrameStageNames[stage];
+}
+
+Int64 LogicFrameProfile::getTicks() const
+{
+	LARGE_INTEGER tick;
+	QueryPerformanceCounter(&tick);
+	return tick.QuadPart;
+}
+
+UnsignedInt LogicFrameProfile::toMicroseconds(Int64 ticks) const
+{
+	return static_cast<UnsignedInt>(ticks * 1000000 / m_freq);
+}
+
+void LogicFrameProfile::beginFrame(UnsignedInt frame)
+{
+	m_frame = frame;
+	for (Int i = 0; i < LOGIC_FRAME_STAGE_COUNT; ++i)
+		m_stageTime[i] = 0;
+	m_frameStart = getTicks();
+}
+
+void LogicFrameProfile::endFrame(UnsignedInt objectCount, UnsignedInt sleepyUpdateCount)
+{
+	const Int64 frameTime = getTicks() - m_frameStart;
+	if (m_file == nullptr)
+		return;
+
+	// Integer math, so that the profile does not touch the floating point state of the logic.
+	fprintf(m_file, "%u,%u", m_frame, toMicroseconds(frameTime));
+	for (Int i = 0; i < LOGIC_FRAME_STAGE_COUNT; ++i)
+		fprintf(m_file, ",%u", toMicroseconds(m_stageTime[i]));
+	fprintf(m_file, ",%u,%u\n", objectCount, sleepyUpdateCount);
+}
+
+void LogicFrameProfile::startStage(LogicFrameStage stage)
+{
+	m_stageStart[stage] = getTicks();
+}
+
+void LogicFrameProfile::stopStage(LogicFrameStage stage)
+{
+	m_stageTime[stage] += getTicks() - m_stageStart[stage];
+}
@@ -76,6 +76,20 @@ UnsignedInt GetGameLogicRandomSeedCRC()
 	return c.get();
 }
 
+// TheSuperHackers @feature 18/10/2026 Used by replay snapshots to restore the exact logic random sequence.
+void GetGameLogicRandomState(UnsignedInt (&state)[GAME_LOGIC_RANDOM_STATE_SIZE], UnsignedInt &baseSeed)
+{
+	static_assert(sizeof(state) == sizeof(theGameLogicSeed), "Incorrect array size");
+	memcpy(state, theGameLogicSeed, sizeof(theGameLogicSeed));
+	baseSeed = theGameLogicBaseSeed;
+}
+
+void SetGameLogicRandomState(const UnsignedInt (&state)[GAME_LOGIC_RANDOM_STATE_SIZE], UnsignedInt baseSeed)
+{
+	memcpy(theGameLogicSeed, state, sizeof(theGameLogicSeed));
+	theGameLogicBaseSeed = baseSeed;
+}
+
 static void seedRandom(UnsignedInt SEED, UnsignedInt (&seed)[6])
 {
 	UnsignedInt ax;
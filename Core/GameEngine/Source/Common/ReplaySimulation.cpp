@@ -22,10 +22,14 @@
 
 #include "Common/GameEngine.h"
 #include "Common/LocalFileSystem.h"
+#include "Common/LogicFrameProfile.h"
 #include "Common/Recorder.h"
 #include "Common/WorkerProcess.h"
 #include "GameLogic/GameLogic.h"
+#include "GameLogic/PathfindRequestProfile.h"
+#include "GameLogic/UpdateModuleProfile.h"
 #include "GameClient/GameClient.h"
+#include "GameClient/ParticleSys.h"
 
 
 Bool ReplaySimulation::s_isRunning = false;
@@ -45,11 +49,196 @@ int countProcessesRunning(const std::vector<WorkerProcess>& processes)
 	}
 	return numProcessesRunning;
 }
+
+// TheSuperHackers @performance 18/10/2026 -replayParticles updates the particle systems after every logic
+// frame, as the game client would, and adds up the time it takes.
+void updateParticleSystems(Int64& ticks, UnsignedInt& maxParticles)
+{
+	LARGE_INTEGER start;
+	LARGE_INTEGER end;
+	QueryPerformanceCounter(&start);
+	TheParticleSystemManager->update();
+	QueryPerformanceCounter(&end);
+	ticks += end.QuadPart - start.QuadPart;
+	maxParticles = max(maxParticles, TheParticleSystemManager->getParticleCount());
+}
+
+void printParticleSystemSummary(Int64 ticks, UnsignedInt maxParticles)
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	// Whole seconds first, so that long replays do not overflow the multiplication.
+	const UnsignedInt64 micros = static_cast<UnsignedInt64>((ticks / freq.QuadPart) * 1000000 + (ticks % freq.QuadPart) * 1000000 / freq.QuadPart);
+	printf("Particle systems: %I64u us update time, %u particles max\n", micros, maxParticles);
+}
+
+// Range of replays that is simulated by one worker process.
+struct WorkerJob
+{
+	int firstReplay;
+	int numReplays;
+};
+
+// TheSuperHackers @performance A worker process can simulate several replays in sequence to pay the
+// engine startup only once. It then returns a bit mask of the failed replays as exit code. The output
+// of the worker is split at each replay header, so that every replay is reported the same way as if it
+// was simulated in its own process.
+int printWorkerOutput(const WorkerProcess& process, const WorkerJob& job, const std::vector<AsciiString> &filenames)
+{
+	static const char* const replayHeader = "Simulating Replay ";
+
+	const AsciiString stdOutput = process.getStdOutput();
+	const DWORD exitcode = process.getExitCode();
+
+	// Any bit outside of the replay range means the worker did not exit regularly, for example because it
+	// crashed. In that case we cannot tell which replays succeeded and report all of them as failed.
+	// A replay without output was never simulated and fails as well, whatever the exit code says.
+	const Bool crashed = (exitcode >> job.numReplays) != 0;
+
+	int numErrors = 0;
+	const char* chunkBegin = stdOutput.str();
+	const char* header = stdOutput.find(replayHeader);
+	for (int i = 0; i < job.numReplays; ++i)
+	{
+		const int replayIndex = job.firstReplay + i;
+		AsciiString chunk;
+		Bool missing = FALSE;
+		if (header != nullptr)
+		{
+			const char* chunkEnd = i + 1 < job.numReplays ? strstr(header + 1, replayHeader) : nullptr;
+			if (chunkEnd == nullptr)
+				chunkEnd = header + strlen(header);
+			chunk.set(chunkBegin, chunkEnd - chunkBegin);
+			chunkBegin = chunkEnd;
+			header = *chunkEnd != '\0' ? chunkEnd : nullptr;
+		}
+		else if (job.numReplays == 1)
+		{
+			// A windowed worker prints no header for a single replay, so all of its output belongs to it.
+			chunk = stdOutput;
+		}
+		else
+		{
+			chunk.format("Replay \"%s\" was not simulated\n", filenames[replayIndex].str());
+			missing = TRUE;
+		}
+
+		printf("%d/%d %s", replayIndex+1, (int)filenames.size(), chunk.str());
+		const Bool failed = crashed || missing || (exitcode & (1u << i)) != 0;
+		if (failed)
+		{
+			printf("Error!\n");
+			++numErrors;
+		}
+	}
+	fflush(stdout);
+	return numErrors;
+}
+
+AsciiString getMemoryPoolsFilename(const AsciiString& replayFilename)
+{
+	AsciiString filename;
+	filename.format("%s%s.pools.csv", TheRecorder->getReplayDir().str(), replayFilename.str());
+	return filename;
+}
+
+void writeMemoryPools(const AsciiString& replayFilename)
+{
+	const AsciiString filename = getMemoryPoolsFilename(replayFilename);
+	FILE* fp = fopen(filename.str(), "wt");
+	if (fp == nullptr)
+	{
+		printf("Cannot write memory pools \"%s\"\n", filename.str());
+		return;
+	}
+	TheMemoryPoolFactory->poolStatisticsReport(fp);
+	fclose(fp);
+}
+
+struct MemoryPoolPeak
+{
+	Int initial;
+	Int overflow;
+	Int peak;
+	Int overflowBlobs;
+};
+
+// TheSuperHackers @feature 18/10/2026
+// Combines the "<replay>.pools.csv" files of all simulated replays into a table in the format of
+// Data\INI\MemoryPools.ini. The initial size of each pool becomes its highest peak plus an eighth, so that
+// pools which overflowed no longer create blobs during the game and oversized pools give back their memory.
+void writeTunedMemoryPools(const std::vector<AsciiString> &filenames)
+{
+	typedef std::map<AsciiString, MemoryPoolPeak> PeakMap;
+	PeakMap peaks;
+	int numReports = 0;
+
+	for (size_t i = 0; i < filenames.size(); ++i)
+	{
+		FILE* fp = fopen(getMemoryPoolsFilename(filenames[i]).str(), "rt");
+		if (fp == nullptr)
+			continue;
+
+		char line[512];
+		char poolName[256];
+		MemoryPoolPeak rec;
+		Int blockSize, used, total;
+		while (fgets(line, ARRAY_SIZE(line), fp))
+		{
+			if (sscanf(line, "%255[^,],%d,%d,%d,%d,%d,%d,%d", poolName, &blockSize, &rec.initial, &rec.overflow,
+					&used, &rec.peak, &total, &rec.overflowBlobs) != 8)
+				continue;	// the header line
+
+			std::pair<PeakMap::iterator, bool> inserted = peaks.insert(PeakMap::value_type(AsciiString(poolName), rec));
+			if (!inserted.second)
+			{
+				MemoryPoolPeak& peak = inserted.first->second;
+				peak.peak = max(peak.peak, rec.peak);
+				peak.overflowBlobs = max(peak.overflowBlobs, rec.overflowBlobs);
+			}
+		}
+		fclose(fp);
+		++numReports;
+	}
+
+	if (numReports == 0)
+		return;
+
+	AsciiString tunedFilename;
+	tunedFilename.format("%sMemoryPools.tuned.ini", TheRecorder->getReplayDir().str());
+	FILE* fp = fopen(tunedFilename.str(), "wt");
+	if (fp == nullptr)
+	{
+		printf("Cannot write tuned memory pools \"%s\"\n", tunedFilename.str());
+		return;
+	}
+
+	fprintf(fp, "; Initial memory pool sizes from the peak usage of %d simulated replays.\n", numReports);
+	fprintf(fp, "; Copy to Data\\INI\\MemoryPools.ini to use them. Pools that are not in the built-in pool size\n");
+	fprintf(fp, "; table, such as the dmaPool subpools, are ignored there.\n");
+	fprintf(fp, "; name initial overflow ; peak, previous initial, most overflow blobs in one replay\n");
+
+	int numOverflowed = 0;
+	for (PeakMap::const_iterator it = peaks.begin(); it != peaks.end(); ++it)
+	{
+		const MemoryPoolPeak& peak = it->second;
+		// The pools take multiples of 4, see userMemoryManagerInitPools.
+		const Int initial = max((peak.peak + peak.peak / 8 + 3) & ~3, 4);
+		fprintf(fp, "%s %d %d ; %d, %d, %d\n", it->first.str(), initial, peak.overflow, peak.peak, peak.initial, peak.overflowBlobs);
+		if (peak.overflowBlobs != 0)
+			++numOverflowed;
+	}
+	fclose(fp);
+
+	printf("Memory pools that overflowed: %d. Tuned pool sizes written to \"%s\"\n", numOverflowed, tunedFilename.str());
+	fflush(stdout);
+}
 } // namespace
 
-int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames)
+int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames, Bool isBatchWorker)
 {
 	int numErrors = 0;
+	UnsignedInt failedReplayMask = 0;
 
 	if (!TheGlobalData->m_headless)
 	{
@@ -60,10 +249,19 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		// If we are not in headless mode, we need to run the replay in the engine.
 		for (; s_replayIndex < s_replayCount; ++s_replayIndex)
 		{
+			// The parent process splits the output of a worker with several replays at this header.
+			if (isBatchWorker && s_replayCount > 1)
+			{
+				printf("Simulating Replay \"%s\"\n", filenames[s_replayIndex].str());
+				fflush(stdout);
+			}
 			TheRecorder->playbackFile(filenames[s_replayIndex]);
 			TheGameEngine->execute();
 			if (TheRecorder->sawCRCMismatch())
+			{
 				numErrors++;
+				failedReplayMask |= 1u << s_replayIndex;
+			}
 			if (!s_isRunning)
 				break;
 			TheGameEngine->setQuitting(FALSE);
@@ -71,6 +269,8 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		s_isRunning = false;
 		s_replayIndex = 0;
 		s_replayCount = 0;
+		if (isBatchWorker)
+			return failedReplayMask;
 		return numErrors != 0 ? 1 : 0;
 	}
 	// Note that we use printf here because this is run from cmd.
@@ -81,8 +281,41 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		printf("Simulating Replay \"%s\"\n", filename.str());
 		fflush(stdout);
 		DWORD startTimeMillis = GetTickCount();
+		if (TheGlobalData->m_simulateReplayMemoryPools)
+			TheMemoryPoolFactory->resetPoolStatistics();
 		if (TheRecorder->simulateReplay(filename))
 		{
+			if (TheGlobalData->m_simulateReplayProfile)
+			{
+				AsciiString profileFilename;
+				profileFilename.format("%s%s.frames.csv", TheRecorder->getReplayDir().str(), filename.str());
+				TheLogicFrameProfile = NEW LogicFrameProfile;
+				if (!TheLogicFrameProfile->open(profileFilename.str()))
+					printf("Cannot write frame profile \"%s\"\n", profileFilename.str());
+			}
+			if (TheGlobalData->m_simulateReplayPathfindProfile)
+			{
+				AsciiString profileFilename;
+				profileFilename.format("%s%s.pathfind.csv", TheRecorder->getReplayDir().str(), filename.str());
+				ThePathfindRequestProfile = NEW PathfindRequestProfile;
+				if (!ThePathfindRequestProfile->open(profileFilename.str()))
+					printf("Cannot write pathfind profile \"%s\"\n", profileFilename.str());
+			}
+			if (TheGlobalData->m_simulateReplayUpdateProfile)
+				TheUpdateModuleProfile = NEW UpdateModuleProfile;
+			FILE* frameCRCFile = nullptr;
+			if (TheGlobalData->m_simulateReplayFrameCRC)
+			{
+				AsciiString crcFilename;
+				crcFilename.format("%s%s.crc.csv", TheRecorder->getReplayDir().str(), filename.str());
+				frameCRCFile = fopen(crcFilename.str(), "wt");
+				if (frameCRCFile != nullptr)
+					fprintf(frameCRCFile, "frame,crc\n");
+				else
+					printf("Cannot write frame CRC \"%s\"\n", crcFilename.str());
+			}
+			Int64 particleTicks = 0;
+			UnsignedInt maxParticles = 0;
 			UnsignedInt totalTimeSec = TheRecorder->getPlaybackFrameCount() / LOGICFRAMES_PER_SECOND;
 			while (TheRecorder->isPlaybackInProgress())
 			{
@@ -97,12 +330,42 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 					fflush(stdout);
 				}
 				TheGameLogic->UPDATE();
+				if (TheGlobalData->m_simulateReplayParticles)
+					updateParticleSystems(particleTicks, maxParticles);
+				if (frameCRCFile != nullptr)
+					fprintf(frameCRCFile, "%u,%8.8X\n", TheGameLogic->getFrame(), TheGameLogic->getIncrementalCRC());
 				if (TheRecorder->sawCRCMismatch())
 				{
 					numErrors++;
+					failedReplayMask |= 1u << i;
 					break;
 				}
 			}
+			if (frameCRCFile != nullptr)
+				fclose(frameCRCFile);
+			delete TheLogicFrameProfile;
+			TheLogicFrameProfile = nullptr;
+			if (ThePathfindRequestProfile)
+			{
+				ThePathfindRequestProfile->printSummary();
+				delete ThePathfindRequestProfile;
+				ThePathfindRequestProfile = nullptr;
+			}
+			if (TheUpdateModuleProfile)
+			{
+				AsciiString profileFilename;
+				profileFilename.format("%s%s.updates.csv", TheRecorder->getReplayDir().str(), filename.str());
+				if (!TheUpdateModuleProfile->writeCSV(profileFilename.str()))
+					printf("Cannot write update profile \"%s\"\n", profileFilename.str());
+				TheUpdateModuleProfile->printSummary(10);
+				delete TheUpdateModuleProfile;
+				TheUpdateModuleProfile = nullptr;
+			}
+			if (TheGlobalData->m_simulateReplayMemoryPools)
+				writeMemoryPools(filename);
+			if (TheGlobalData->m_simulateReplayParticles)
+				printParticleSystemSummary(particleTicks, maxParticles);
+
 			UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
 			UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
 			printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
@@ -113,8 +376,16 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		{
 			printf("Cannot open replay\n");
 			numErrors++;
+			failedReplayMask |= 1u << i;
 		}
 	}
+	if (isBatchWorker)
+	{
+		// The parent process prints the summary.
+		return failedReplayMask;
+	}
+	if (TheGlobalData->m_simulateReplayMemoryPools)
+		writeTunedMemoryPools(filenames);
 	if (filenames.size() > 1)
 	{
 		printf("Simulation of all replays completed. Errors occurred: %d\n", numErrors);
@@ -127,7 +398,7 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 	return numErrors != 0 ? 1 : 0;
 }
 
-int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses)
+int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerJob)
 {
 	DWORD totalStartTimeMillis = GetTickCount();
 
@@ -135,6 +406,7 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	GetModuleFileNameW(nullptr, exePath, ARRAY_SIZE(exePath));
 
 	std::vector<WorkerProcess> processes;
+	std::vector<WorkerJob> jobs;
 	int filenamePositionStarted = 0;
 	int filenamePositionDone = 0;
 	int numErrors = 0;
@@ -150,15 +422,23 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 		{
 			if (!processes[0].isDone())
 				break;
-			AsciiString stdOutput = processes[0].getStdOutput();
-			printf("%d/%d %s", filenamePositionDone+1, (int)filenames.size(), stdOutput.str());
-			DWORD exitcode = processes[0].getExitCode();
-			if (exitcode != 0)
-				printf("Error!\n");
-			fflush(stdout);
-			numErrors += exitcode == 0 ? 0 : 1;
+			if (replaysPerJob > 1)
+			{
+				numErrors += printWorkerOutput(processes[0], jobs[0], filenames);
+			}
+			else
+			{
+				AsciiString stdOutput = processes[0].getStdOutput();
+				printf("%d/%d %s", filenamePositionDone+1, (int)filenames.size(), stdOutput.str());
+				DWORD exitcode = processes[0].getExitCode();
+				if (exitcode != 0)
+					printf("Error!\n");
+				fflush(stdout);
+				numErrors += exitcode == 0 ? 0 : 1;
+			}
+			filenamePositionDone += jobs[0].numReplays;
 			processes.erase(processes.begin());
-			filenamePositionDone++;
+			jobs.erase(jobs.begin());
 		}
 
 		int numProcessesRunning = countProcessesRunning(processes);
@@ -166,19 +446,49 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 		// Add new processes when we are below the limit and there are replays left
 		while (numProcessesRunning < maxProcesses && filenamePositionStarted < filenames.size())
 		{
-			UnicodeString filenameWide;
-			filenameWide.translate(filenames[filenamePositionStarted]);
+			WorkerJob job;
+			job.firstReplay = filenamePositionStarted;
+			job.numReplays = min(replaysPerJob, (int)filenames.size() - filenamePositionStarted);
+
 			UnicodeString command;
-			command.format(L"\"%s\"%s%s -replay \"%s\"",
+			command.format(L"\"%s\"%s%s%s%s%s%s%s%s",
 				exePath,
 				TheGlobalData->m_windowed ? L" -win" : L"",
 				TheGlobalData->m_headless ? L" -headless" : L"",
-				filenameWide.str());
+				TheGlobalData->m_simulateReplayProfile ? L" -replayProfile" : L"",
+				TheGlobalData->m_simulateReplayPathfindProfile ? L" -replayPathfindProfile" : L"",
+				TheGlobalData->m_simulateReplayUpdateProfile ? L" -replayUpdateProfile" : L"",
+				TheGlobalData->m_simulateReplayMemoryPools ? L" -replayMemoryPools" : L"",
+				TheGlobalData->m_simulateReplayFrameCRC ? L" -replayFrameCRC" : L"",
+				TheGlobalData->m_simulateReplayParticles ? L" -replayParticles" : L"");
+			// Always mark the worker, so that it leaves the summary and the tuned memory pools to this process.
+			command.concat(L" -replayBatchWorker");
+			if (TheGlobalData->m_replaySnapshotInterval != 0)
+			{
+				UnicodeString arg;
+				arg.format(L" -replaySnapshotInterval %u", TheGlobalData->m_replaySnapshotInterval);
+				command.concat(arg);
+			}
+			if (TheGlobalData->m_replayResumeFrame != 0)
+			{
+				UnicodeString arg;
+				arg.format(L" -replayResumeFrame %u", TheGlobalData->m_replayResumeFrame);
+				command.concat(arg);
+			}
+			for (int r = 0; r < job.numReplays; ++r)
+			{
+				UnicodeString filenameWide;
+				filenameWide.translate(filenames[job.firstReplay + r]);
+				UnicodeString arg;
+				arg.format(L" -replay \"%s\"", filenameWide.str());
+				command.concat(arg);
+			}
 
 			processes.push_back(WorkerProcess());
 			processes.back().startProcess(command);
+			jobs.push_back(job);
 
-			filenamePositionStarted++;
+			filenamePositionStarted += job.numReplays;
 			numProcessesRunning++;
 		}
 
@@ -194,6 +504,9 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 
 	printf("Simulation of all replays completed. Errors occurred: %d\n", numErrors);
 
+	if (TheGlobalData->m_simulateReplayMemoryPools)
+		writeTunedMemoryPools(filenames);
+
 	UnsignedInt realTime = (GetTickCount()-totalStartTimeMillis) / 1000;
 	printf("Total Wall Time: %d:%02d:%02d\n", realTime/60/60, realTime/60%60, realTime%60);
 	fflush(stdout);
@@ -243,11 +556,13 @@ std::vector<AsciiString> ReplaySimulation::resolveFilenameWildcards(const std::v
 	return filenamesResolved;
 }
 
-int ReplaySimulation::simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses)
+int ReplaySimulation::simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerJob)
 {
 	std::vector<AsciiString> filenamesResolved = resolveFilenameWildcards(filenames);
 	if (maxProcesses == SIMULATE_REPLAYS_SEQUENTIAL)
-		return simulateReplaysInThisProcess(filenamesResolved);
+	{
+		return simulateReplaysInThisProcess(filenamesResolved, TheGlobalData->m_simulateReplayBatchWorker);
+	}
 	else
-		return simulateReplaysInWorkerProcesses(filenamesResolved, maxProcesses);
+		return simulateReplaysInWorkerProcesses(filenamesResolved, maxProcesses, replaysPerJob);
 }
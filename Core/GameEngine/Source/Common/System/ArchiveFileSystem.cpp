@@ -168,6 +168,15 @@ void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool ove
 
 		dirInfo->m_files.insert(fileIt, std::make_pair(token, archiveFile));
 
+		// Keep the index in the same instance order as the directory tree.
+		AsciiString key = path;
+		key.concat(token);
+		std::vector<ArchiveFile *>& locations = m_fileIndex[key];
+		if (overwrite)
+			locations.insert(locations.begin(), archiveFile);
+		else
+			locations.push_back(archiveFile);
+
 #if defined(DEBUG_LOGGING) && ENABLE_FILESYSTEM_LOGGING
 		{
 			const stl::const_range<ArchivedFileLocationMap> range = stl::get_range(dirInfo->m_files, token, 0);
@@ -238,14 +247,59 @@ void ArchiveFileSystem::loadMods()
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
+	return getArchiveFile(filename, instance) != nullptr;
+}
+
+void ArchiveFileSystem::removeFromFileIndex(ArchiveFile *archiveFile)
+{
+	ArchivedFileLocationIndex::iterator it = m_fileIndex.begin();
+	while (it != m_fileIndex.end())
+	{
+		std::vector<ArchiveFile *>& locations = it->second;
+		locations.erase(std::remove(locations.begin(), locations.end(), archiveFile), locations.end());
 
-	if (!result.valid())
-		return false;
+		if (locations.empty())
+			m_fileIndex.erase(it++);
+		else
+			++it;
+	}
+}
 
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
+AsciiString ArchiveFileSystem::makeLookupKey(const Char *path)
+{
+	char key[_MAX_PATH * 2];
+	Int keyLength = 0;
+	const Char *p = path;
 
-	return range.valid();
+	for (;;)
+	{
+		while (*p == '\\' || *p == '/')
+			++p;
+
+		if (*p == 0)
+			break;
+
+		Bool hasDot = FALSE;
+		while (*p != 0 && *p != '\\' && *p != '/')
+		{
+			if (keyLength == ARRAY_SIZE(key) - 2)
+				return AsciiString::TheEmptyString;
+
+			hasDot |= (*p == '.');
+			key[keyLength++] = (char)tolower((unsigned char)*p);
+			++p;
+		}
+
+		// A name with a dot is the file name unless the rest of the path still has a dot. The rest after the
+		// file name is ignored.
+		if (hasDot && strchr(p, '.') == nullptr)
+			break;
+
+		key[keyLength++] = '\\';
+	}
+
+	key[keyLength] = 0;
+	return AsciiString(key);
 }
 
 ArchivedDirectoryInfo* ArchiveFileSystem::friend_getArchivedDirectoryInfo(const Char* directory)
@@ -317,17 +371,13 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 
 ArchiveFile* ArchiveFileSystem::getArchiveFile(const AsciiString& filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename.str());
+	// TheSuperHackers @performance 18/10/2026 Look the file up in the flat index instead of walking the directory tree.
+	ArchivedFileLocationIndex::const_iterator it = m_fileIndex.find(makeLookupKey(filename.str()));
 
-	if (!result.valid())
+	if (it == m_fileIndex.end() || instance >= it->second.size())
 		return nullptr;
 
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
-
-	if (!range.valid())
-		return nullptr;
-	
-	return range.get()->second;
+	return it->second[instance];
 }
 
 void ArchiveFileSystem::getFileListInDirectory(const AsciiString& currentDirectory, const AsciiString& originalDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const
@@ -89,6 +89,14 @@ void MemoryPoolFactory::memoryPoolUsageReport( const char* filename, FILE *appen
 {
 }
 
+void MemoryPoolFactory::resetPoolStatistics()
+{
+}
+
+void MemoryPoolFactory::poolStatisticsReport(FILE *fp)
+{
+}
+
 #ifdef MEMORYPOOL_DEBUG
 void MemoryPoolFactory::debugMemoryReport(Int flags, Int startCheckpoint, Int endCheckpoint, FILE *fp )
 {
@@ -155,6 +163,16 @@ void shutdownMemoryManager()
 	DEBUG_SHUTDOWN();
 }
 
+//-----------------------------------------------------------------------------
+void initMemoryPoolThreadCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+void shutdownMemoryPoolThreadCache()
+{
+}
+
 
 #ifndef DISABLE_GAMEMEMORY_NEW_OPERATORS
 
@@ -52,6 +52,10 @@
 #include <sys/stat.h>
 #include <stdlib.h>
 #include <ctype.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include "Common/LocalFile.h"
 #include "Common/RAMFile.h"
@@ -328,6 +332,119 @@ void LocalFile::closeFile()
 #endif
 }
 
+//=================================================================
+// LocalFile::mapView
+//=================================================================
+
+const char* LocalFile::mapView( Int offset, Int size, LocalFileView &view )
+{
+	view.m_base = nullptr;
+	view.m_size = 0;
+
+	if (offset < 0 || size <= 0)
+	{
+		return nullptr;
+	}
+
+#if USE_BUFFERED_IO
+	if (m_file == nullptr)
+	{
+		return nullptr;
+	}
+#ifdef _WIN32
+	const int fd = _fileno(m_file);
+#else
+	const int fd = fileno(m_file);
+#endif
+#else
+	if (m_handle == -1)
+	{
+		return nullptr;
+	}
+	const int fd = m_handle;
+#endif
+
+	// A corrupt or truncated archive must fail here. A view past the end of the file faults when it is read.
+	const Int fileSize = this->size();
+	if (offset > fileSize || size > fileSize - offset)
+	{
+		return nullptr;
+	}
+
+	// Views must start at a multiple of the allocation granularity, so the view begins a little before the data.
+	static size_t s_granularity = 0;
+	if (s_granularity == 0)
+	{
+#ifdef _WIN32
+		SYSTEM_INFO systemInfo;
+		GetSystemInfo(&systemInfo);
+		s_granularity = systemInfo.dwAllocationGranularity;
+#else
+		s_granularity = (size_t)sysconf(_SC_PAGESIZE);
+#endif
+	}
+
+	const size_t alignedOffset = (size_t)offset - ((size_t)offset % s_granularity);
+	const size_t delta = (size_t)offset - alignedOffset;
+	const size_t viewSize = delta + (size_t)size;
+
+#ifdef _WIN32
+	HANDLE fileHandle = (HANDLE)_get_osfhandle(fd);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		return nullptr;
+	}
+
+	HANDLE mapping = CreateFileMapping(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		return nullptr;
+	}
+
+	void *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, (DWORD)alignedOffset, viewSize);
+
+	// The view keeps the mapping alive until it is unmapped.
+	CloseHandle(mapping);
+
+	if (base == nullptr)
+	{
+		return nullptr;
+	}
+#else
+	void *base = mmap(nullptr, viewSize, PROT_READ, MAP_PRIVATE, fd, (off_t)alignedOffset);
+	if (base == MAP_FAILED)
+	{
+		return nullptr;
+	}
+#endif
+
+	view.m_base = base;
+	view.m_size = viewSize;
+
+	return static_cast<const char*>(base) + delta;
+}
+
+//=================================================================
+// LocalFile::unmapView
+//=================================================================
+
+void LocalFile::unmapView( LocalFileView &view )
+{
+	if (view.m_base == nullptr)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(view.m_base);
+#else
+	munmap(view.m_base, view.m_size);
+#endif
+
+	view.m_base = nullptr;
+	view.m_size = 0;
+}
+
 //=================================================================
 // LocalFile::read
 //=================================================================
@@ -0,0 +1,101 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "Common/MappedArchiveFile.h"
+
+// Mapping costs a few system calls and at least one allocation granularity of address space, so it only pays off
+// for larger files. Smaller ones are copied.
+static const Int MIN_MAPPED_FILE_SIZE = 64 * 1024;
+
+//-------------------------------------------------------------------------------------------------
+MappedArchiveFile::MappedArchiveFile()
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+MappedArchiveFile::~MappedArchiveFile()
+{
+	unmap();
+}
+
+//-------------------------------------------------------------------------------------------------
+void MappedArchiveFile::close()
+{
+	unmap();
+	RAMFile::close();
+}
+
+//-------------------------------------------------------------------------------------------------
+void MappedArchiveFile::unmap()
+{
+	if (m_view.m_base != nullptr)
+	{
+		LocalFile::unmapView(m_view);
+
+		// m_data points into the view and must not be deleted by RAMFile.
+		m_data = nullptr;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool MappedArchiveFile::openFromLocalArchive(LocalFile *archiveFile, const AsciiString& filename, Int offset, Int size)
+{
+	if (archiveFile == nullptr)
+	{
+		return FALSE;
+	}
+
+	if (size >= MIN_MAPPED_FILE_SIZE)
+	{
+		const char *data = archiveFile->mapView(offset, size, m_view);
+		if (data != nullptr)
+		{
+			if (File::open(filename.str(), File::READ | File::BINARY) == FALSE)
+			{
+				LocalFile::unmapView(m_view);
+				return FALSE;
+			}
+
+			// RAMFile never writes to m_data.
+			m_data = const_cast<char*>(data);
+			m_size = size;
+			m_pos = 0;
+			m_nameStr = filename;
+			return TRUE;
+		}
+	}
+
+	return RAMFile::openFromArchive(archiveFile, filename, offset, size);
+}
+
+//-------------------------------------------------------------------------------------------------
+char* MappedArchiveFile::readEntireAndClose()
+{
+	if (m_view.m_base == nullptr)
+	{
+		return RAMFile::readEntireAndClose();
+	}
+
+	char *data = MSGNEW("RAMFILE") char[m_size];
+	memcpy(data, m_data, m_size);
+
+	close();
+
+	return data;
+}
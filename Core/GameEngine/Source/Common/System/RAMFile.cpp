@@ -536,6 +536,15 @@ File* RAMFile::convertToRAMFile()
 	return this;
 }
 
+//=================================================================
+// RAMFile::getEntireContents
+//=================================================================
+
+const char* RAMFile::getEntireContents()
+{
+	return m_data;
+}
+
 //=================================================================
 // RAMFile::readEntireAndClose
 //=================================================================
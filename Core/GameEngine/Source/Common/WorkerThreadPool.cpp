@@ -0,0 +1,191 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "Common/WorkerThreadPool.h"
+
+#include "WWLib/thread.h"
+
+void setFPMode();
+
+WorkerThreadPool *TheWorkerThreadPool = nullptr;
+
+//-------------------------------------------------------------------------------------------------
+class WorkerThread : public ThreadClass
+{
+public:
+	WorkerThread(WorkerThreadPool *pool, Int threadIndex) : ThreadClass("WorkerThread"), m_pool(pool), m_threadIndex(threadIndex) {}
+
+	virtual void Thread_Function() override
+	{
+		// The logic relies on the FPU mode for consistent floating point results.
+		setFPMode();
+		initMemoryPoolThreadCache();
+		m_pool->workerLoop(m_threadIndex);
+		shutdownMemoryPoolThreadCache();
+	}
+
+private:
+	WorkerThreadPool *m_pool;
+	Int m_threadIndex;
+};
+
+//-------------------------------------------------------------------------------------------------
+WorkerThreadPool::WorkerThreadPool() :
+	m_doneEvent(nullptr),
+	m_job(nullptr),
+	m_count(0),
+	m_nextIndex(0),
+	m_busyThreads(0),
+	m_quit(FALSE),
+	m_isRunning(FALSE),
+	m_numThreads(0)
+{
+	for (Int i = 0; i < MAX_WORKER_THREADS; ++i)
+	{
+		m_threads[i] = nullptr;
+		m_startEvents[i] = nullptr;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+WorkerThreadPool::~WorkerThreadPool()
+{
+	shutdown();
+}
+
+//-------------------------------------------------------------------------------------------------
+Int WorkerThreadPool::getDefaultNumThreads()
+{
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	Int numThreads = (Int)systemInfo.dwNumberOfProcessors - 1;
+	return clamp(0, numThreads, (Int)MAX_WORKER_THREADS);
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::init(Int numThreads)
+{
+	shutdown();
+
+	m_numThreads = clamp(0, numThreads, (Int)MAX_WORKER_THREADS);
+	if (m_numThreads == 0)
+		return;
+
+	m_quit = FALSE;
+	m_doneEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	for (Int i = 0; i < m_numThreads; ++i)
+	{
+		m_startEvents[i] = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+		m_threads[i] = NEW WorkerThread(this, i);
+		m_threads[i]->Execute();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::shutdown()
+{
+	DEBUG_ASSERTCRASH(!m_isRunning, ("WorkerThreadPool::shutdown - a job is still running"));
+
+	m_quit = TRUE;
+	for (Int i = 0; i < m_numThreads; ++i)
+	{
+		SetEvent(m_startEvents[i]);
+	}
+	for (Int i = 0; i < m_numThreads; ++i)
+	{
+		delete m_threads[i];
+		m_threads[i] = nullptr;
+		CloseHandle(m_startEvents[i]);
+		m_startEvents[i] = nullptr;
+	}
+	if (m_doneEvent)
+	{
+		CloseHandle(m_doneEvent);
+		m_doneEvent = nullptr;
+	}
+	m_numThreads = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::run(WorkerThreadJob *job, Int count)
+{
+	DEBUG_ASSERTCRASH(!m_isRunning, ("WorkerThreadPool::run is not reentrant"));
+
+	if (count <= 0)
+		return;
+
+	if (m_numThreads == 0 || count == 1)
+	{
+		for (Int i = 0; i < count; ++i)
+		{
+			job->runJob(i);
+		}
+		return;
+	}
+
+	m_isRunning = TRUE;
+	m_job = job;
+	m_count = count;
+	m_nextIndex = 0;
+
+	const Int numWorkers = min(m_numThreads, count - 1);
+	m_busyThreads = numWorkers;
+	for (Int i = 0; i < numWorkers; ++i)
+	{
+		SetEvent(m_startEvents[i]);
+	}
+
+	runIndices();
+
+	WaitForSingleObject(m_doneEvent, INFINITE);
+
+	m_job = nullptr;
+	m_count = 0;
+	m_isRunning = FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::runIndices()
+{
+	for (;;)
+	{
+		const Int index = (Int)InterlockedIncrement(&m_nextIndex) - 1;
+		if (index >= m_count)
+			break;
+		m_job->runJob(index);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::workerLoop(Int threadIndex)
+{
+	for (;;)
+	{
+		WaitForSingleObject(m_startEvents[threadIndex], INFINITE);
+		if (m_quit)
+			break;
+
+		runIndices();
+
+		if (InterlockedDecrement(&m_busyThreads) == 0)
+		{
+			SetEvent(m_doneEvent);
+		}
+	}
+}
@@ -75,6 +75,7 @@
 #include "GameLogic/PartitionManager.h"
 #include "GameLogic/ScriptEngine.h"
 #include "GameLogic/TerrainLogic.h"
+#include "GameLogic/UpdateModuleProfile.h"
 #include "GameLogic/GhostObject.h"
 #include "GameLogic/Weapon.h"
 #include "GameLogic/Module/SpawnBehavior.h"
@@ -5541,6 +5542,24 @@ GameMessageDisposition CommandTranslator::translateGameMessage(const GameMessage
 		{
 			TheInGameUI->messageNoFormat( TheGameText->FETCH_OR_SUBSTITUTE_FORMAT("GUI:DebugIncreaseAnimSkateSpeed",
 				L"Number of Sleepy Modules: %d", TheGameLogic->getNumberSleepyUpdates() ) );
+
+			// TheSuperHackers @feature 18/10/2026 Also toggles the update module profile on the debug display.
+			// It starts recording when shown and is thrown away when hidden, unless replay simulation owns it.
+			if (TheDisplay->getDebugDisplayCallback() == UpdateModuleProfileDebugDisplay)
+			{
+				TheDisplay->setDebugDisplayCallback(nullptr);
+				if (!TheGlobalData->m_simulateReplayUpdateProfile)
+				{
+					delete TheUpdateModuleProfile;
+					TheUpdateModuleProfile = nullptr;
+				}
+			}
+			else
+			{
+				if (TheUpdateModuleProfile == nullptr)
+					TheUpdateModuleProfile = NEW UpdateModuleProfile;
+				TheDisplay->setDebugDisplayCallback(UpdateModuleProfileDebugDisplay);
+			}
 			break;
 		}
 
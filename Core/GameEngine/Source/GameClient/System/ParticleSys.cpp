@@ -36,6 +36,7 @@
 #include "Common/PerfTimer.h"
 #include "Common/ThingFactory.h"
 #include "Common/GameLOD.h"
+#include "Common/WorkerThreadPool.h"
 #include "Common/Xfer.h"
 
 #include "GameClient/Drawable.h"
@@ -269,6 +270,7 @@ Particle::Particle( ParticleSystem *system, const ParticleInfo *info )
 	m_system = system;
 
 	m_isCulled = FALSE;
+	m_isDead = FALSE;
 	m_accel.x = 0.0f;
 	m_accel.y = 0.0f;
 	m_accel.z = 0.0f;
@@ -371,8 +373,12 @@ void Particle::applyForce( const Coord3D *force )
 // ------------------------------------------------------------------------------------------------
 /** Update the behavior of an individual particle */
 // ------------------------------------------------------------------------------------------------
-Bool Particle::update()
+Bool Particle::update( const ParticleUpdateInfo &info )
 {
+	// apply 'gravity' force
+	if (info.m_gravity != 0.0f)
+		m_accel.z += info.m_gravity;
+
 	// integrate acceleration into velocity
 	m_vel.x += m_accel.x;
 	m_vel.y += m_accel.y;
@@ -383,17 +389,13 @@ Bool Particle::update()
 	m_vel.z *= m_velDamping;
 
 	// integrate velocity into position
-	const Coord3D *driftVel = m_system->getDriftVelocity();
-	m_pos.x += m_vel.x + driftVel->x;
-	m_pos.y += m_vel.y + driftVel->y;
-	m_pos.z += m_vel.z + driftVel->z;
+	m_pos.x += m_vel.x + info.m_driftVel.x;
+	m_pos.y += m_vel.y + info.m_driftVel.y;
+	m_pos.z += m_vel.z + info.m_driftVel.z;
 
 	// integrate the wind (if specified) into position
-	ParticleSystemInfo::WindMotion windMotion = m_system->getWindMotion();
-
-	// see if we should even do anything
-	if( windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED )
-		doWindMotion();
+	if( info.m_doWindMotion )
+		doWindMotion( info );
 
 	// update orientation
 #if PARTICLE_USE_XY_ROTATION
@@ -424,13 +426,13 @@ Bool Particle::update()
 	// Update alpha (if used)
 	//
 
-	if (m_system->getShaderType() != ParticleSystemInfo::ADDITIVE)
+	if (info.m_updateAlpha)
 	{
 		m_alpha += m_alphaRate;
 
 		if (m_alphaTargetKey < MAX_KEYFRAMES && m_alphaKey[ m_alphaTargetKey ].frame)
 		{
-			if (TheGameClient->getFrame() - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
+			if (info.m_frame - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
 			{
 				m_alpha = m_alphaKey[ m_alphaTargetKey ].value;
 				m_alphaTargetKey++;
@@ -456,7 +458,7 @@ Bool Particle::update()
 
 	if (m_colorTargetKey < MAX_KEYFRAMES && m_colorKey[ m_colorTargetKey ].frame)
 	{
-		if (TheGameClient->getFrame() - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
+		if (info.m_frame - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
 		{
 			// can't set, because of colorscale
 			// m_color = m_colorKey[ m_colorTargetKey ].color;
@@ -519,47 +521,11 @@ Bool Particle::update()
 // ------------------------------------------------------------------------------------------------
 /** Do wind motion as specified by the particle system template, if present */
 // ------------------------------------------------------------------------------------------------
-void Particle::doWindMotion()
+void Particle::doWindMotion( const ParticleUpdateInfo &info )
 {
 
-	// get the angle of the wind
-	Real windAngle = m_system->getWindAngle();
-
-	// get the system position
-	Coord3D systemPos;
-	m_system->getPosition( &systemPos );
-
-	// when we're attached objects and drawables we offset by that position as well
-	if( ObjectID attachedObj = m_system->getAttachedObject() )
-	{
-		Object *obj = TheGameLogic->findObjectByID( attachedObj );
-
-		if( obj )
-		{
-			const Coord3D *objPos = obj->getPosition();
-
-			systemPos.x += objPos->x;
-			systemPos.y += objPos->y;
-			systemPos.z += objPos->z;
-
-		}
-
-	}
-	else if( DrawableID attachedDraw = m_system->getAttachedDrawable() )
-	{
-		Drawable *draw = TheGameClient->findDrawableByID( attachedDraw );
-
-		if( draw )
-		{
-			const Coord3D *drawPos = draw->getPosition();
-
-			systemPos.x += drawPos->x;
-			systemPos.y += drawPos->y;
-			systemPos.z += drawPos->z;
-
-		}
-
-	}
+	// the system position, offset by the object or drawable it is attached to
+	const Coord3D &systemPos = info.m_windPos;
 
 	//
 	// compute a vector from the system position in the world to the particle ... we will use
@@ -591,8 +557,8 @@ void Particle::doWindMotion()
 																		(noForceDistance - fullForceDistance)));
 
 		// integrate the wind motion into the position
-		m_pos.x += (Cos( windAngle ) * windForceStrength);
-		m_pos.y += (Sin( windAngle ) * windForceStrength);
+		m_pos.x += (info.m_windCos * windForceStrength);
+		m_pos.y += (info.m_windSin * windForceStrength);
 
 	}
 
@@ -1097,6 +1063,7 @@ ParticleSystem::ParticleSystem( const ParticleSystemTemplate *sysTemplate,
 	m_isStopped = false;
 	m_isDestroyed = false;
 	m_isSaveable = true;
+	m_isUpdatedConcurrently = false;
 
 	m_slavePosOffset = sysTemplate->m_slavePosOffset;
 
@@ -1914,9 +1881,30 @@ const ParticleInfo *ParticleSystem::generateParticleInfo( Int particleNum, Int p
 /** Update this particle system, potentially generating new particles */
 // ------------------------------------------------------------------------------------------------
 Bool ParticleSystem::update( Int localPlayerIndex  )
+{
+	Bool isAlive;
+	if (beginUpdate( localPlayerIndex, &isAlive ) == false)
+		return isAlive;
+
+	ParticleUpdateInfo updateInfo;
+	getParticleUpdateInfo( &updateInfo );
+	updateParticles( updateInfo );
+
+	return endUpdate();
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Update this particle system up to moving its particles, potentially generating new particles.
+	* If this returns false, the particles are not updated this frame and isAlive tells whether the
+	* system is still alive. */
+// ------------------------------------------------------------------------------------------------
+Bool ParticleSystem::beginUpdate( Int localPlayerIndex, Bool *isAlive )
 {
 	if (TheGlobalData->m_useFX == FALSE)
+	{
+		*isAlive = false;
 		return false;
+	}
 
 	// do initial delay ... note, this currently delays the lifetime
 	if (m_delayLeft)
@@ -1928,7 +1916,8 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 		if (m_delayLeft == 0)
 			m_startTimestamp = TheGameClient->getFrame();
 
-		return true;
+		*isAlive = true;
+		return false;
 	}
 
 	// update the wind motion
@@ -2109,25 +2098,31 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 		}
 	}
 
-	//
-	// Update all particles in the system
-	//
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Update all particles in the system. Dead particles are only marked, endUpdate deletes them. */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::updateParticles( const ParticleUpdateInfo &info )
+{
+	for (Particle *p = m_systemParticlesHead; p; p = p->m_systemNext)
+	{
+		if (p->update( info ) == false)
+			p->m_isDead = TRUE;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Delete the particles that died in updateParticles and monitor the system lifetime */
+// ------------------------------------------------------------------------------------------------
+Bool ParticleSystem::endUpdate()
+{
 	Particle *p = m_systemParticlesHead;
 	Particle *oldParticle;
 	while (p)
 	{
-
-		// apply 'gravity' force
-		if (m_gravity != 0.0f)
-		{
-			Coord3D force;
-			force.x = 0.0f;
-			force.y = 0.0f;
-			force.z = m_gravity;
-			p->applyForce( &force );
-		}
-
-		if (p->update() == false)
+		if (p->m_isDead)
 		{
 			oldParticle = p;
 			p = p->m_systemNext;
@@ -2164,6 +2159,76 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Return true if the particles of this system can be moved while other systems update. A system
+	* whose particles control systems, or that is part of a master and slave pair, or that is
+	* controlled by a particle of another system, reads or changes the state of other systems.
+	* Systems attached to an Object or Drawable only read them in beginUpdate and
+	* getParticleUpdateInfo, which still run on the calling thread. */
+// ------------------------------------------------------------------------------------------------
+Bool ParticleSystem::canUpdateParticlesConcurrently() const
+{
+	return m_attachedSystemName.isEmpty()
+		&& m_slaveSystem == nullptr
+		&& m_masterSystem == nullptr
+		&& m_controlParticle == nullptr
+		&& m_particleType != DRAWABLE;
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Gather the values that all particles of this system use in their update this frame */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::getParticleUpdateInfo( ParticleUpdateInfo *info )
+{
+	info->m_driftVel = m_driftVelocity;
+	info->m_gravity = m_gravity;
+	info->m_frame = TheGameClient->getFrame();
+	info->m_updateAlpha = (m_shaderType != ParticleSystemInfo::ADDITIVE);
+	info->m_doWindMotion = (m_windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED);
+
+	if( info->m_doWindMotion == FALSE )
+		return;
+
+	info->m_windCos = Cos( m_windAngle );
+	info->m_windSin = Sin( m_windAngle );
+
+	// get the system position
+	getPosition( &info->m_windPos );
+
+	// when we're attached objects and drawables we offset by that position as well
+	if( m_attachedToObjectID )
+	{
+		Object *obj = TheGameLogic->findObjectByID( m_attachedToObjectID );
+
+		if( obj )
+		{
+			const Coord3D *objPos = obj->getPosition();
+
+			info->m_windPos.x += objPos->x;
+			info->m_windPos.y += objPos->y;
+			info->m_windPos.z += objPos->z;
+
+		}
+
+	}
+	else if( m_attachedToDrawableID )
+	{
+		Drawable *draw = TheGameClient->findDrawableByID( m_attachedToDrawableID );
+
+		if( draw )
+		{
+			const Coord3D *drawPos = draw->getPosition();
+
+			info->m_windPos.x += drawPos->x;
+			info->m_windPos.y += drawPos->y;
+			info->m_windPos.z += drawPos->z;
+
+		}
+
+	}
+
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Update the wind motion */
 // ------------------------------------------------------------------------------------------------
@@ -2992,6 +3057,25 @@ void ParticleSystemManager::reset()
 	// leave templates as-is
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Moves the particles of one particle system per index. Each index only writes to the particles
+	* of its own system. */
+// ------------------------------------------------------------------------------------------------
+class ParticleUpdateJob : public WorkerThreadJob
+{
+public:
+	ParticleUpdateJob(std::vector<ParticleSystemManager::ConcurrentParticleUpdate> &updates) : m_updates(updates) {}
+
+	virtual void runJob(Int index) override
+	{
+		ParticleSystemManager::ConcurrentParticleUpdate &update = m_updates[index];
+		update.m_system->updateParticles(update.m_info);
+	}
+
+private:
+	std::vector<ParticleSystemManager::ConcurrentParticleUpdate> &m_updates;
+};
+
 // ------------------------------------------------------------------------------------------------
 /** Update all particle systems */
 // ------------------------------------------------------------------------------------------------
@@ -3006,13 +3090,77 @@ void ParticleSystemManager::update()
 	m_lastLogicFrameUpdate = TheGameLogic->getFrame();
 
 	//USE_PERF_TIMER(ParticleSystemManager)
-	ParticleSystemListIt it = m_allParticleSystemList.begin();
+
+	// TheSuperHackers @performance 18/10/2026 With many particles, the systems that do not affect other systems
+	// emit their particles first, in system order. Their particles are then moved on TheWorkerThreadPool and
+	// their dead particles deleted in system order, before the other systems update here. That way the particle
+	// count that the other systems see when they emit does not include dead particles.
+	const Bool useWorkerThreads = TheWorkerThreadPool != nullptr
+		&& TheWorkerThreadPool->getNumThreads() > 0
+		&& m_particleCount >= MIN_PARTICLES_FOR_WORKER_THREADS;
+
+	ParticleSystemListIt it;
+	if (useWorkerThreads)
+	{
+		m_concurrentUpdates.clear();
+
+		it = m_allParticleSystemList.begin();
+		while( it != m_allParticleSystemList.end() )
+		{
+			// TheSuperHackers @info Must increment the list iterator before potential element erasure from the list.
+			ParticleSystem* sys = *it++;
+			DEBUG_ASSERTCRASH(sys != nullptr, ("ParticleSystemManager::update: ParticleSystem is null"));
+
+			if (!sys->canUpdateParticlesConcurrently())
+				continue;
+
+			sys->friend_setUpdatedConcurrently(true);
+
+			Bool isAlive;
+			if (sys->beginUpdate(m_localPlayerIndex, &isAlive))
+			{
+				ConcurrentParticleUpdate update;
+				update.m_system = sys;
+				sys->getParticleUpdateInfo(&update.m_info);
+				m_concurrentUpdates.push_back(update);
+			}
+			else if (isAlive == false)
+			{
+				deleteInstance(sys);
+			}
+		}
+
+		if (!m_concurrentUpdates.empty())
+		{
+			ParticleUpdateJob job(m_concurrentUpdates);
+			TheWorkerThreadPool->run(&job, (Int)m_concurrentUpdates.size());
+
+			for (size_t i = 0; i < m_concurrentUpdates.size(); ++i)
+			{
+				ParticleSystem *sys = m_concurrentUpdates[i].m_system;
+				if (sys->endUpdate() == false)
+				{
+					deleteInstance(sys);
+				}
+			}
+
+			m_concurrentUpdates.clear();
+		}
+	}
+
+	it = m_allParticleSystemList.begin();
 	while( it != m_allParticleSystemList.end() )
 	{
 		// TheSuperHackers @info Must increment the list iterator before potential element erasure from the list.
 		ParticleSystem* sys = *it++;
 		DEBUG_ASSERTCRASH(sys != nullptr, ("ParticleSystemManager::update: ParticleSystem is null"));
 
+		if (sys->friend_isUpdatedConcurrently())
+		{
+			sys->friend_setUpdatedConcurrently(false);
+			continue;
+		}
+
 		if (sys->update(m_localPlayerIndex) == false)
 		{
 			deleteInstance(sys);
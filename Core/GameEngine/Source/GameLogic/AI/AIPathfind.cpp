@@ -47,6 +47,7 @@
 #include "GameLogic/Module/PhysicsUpdate.h"
 #include "GameLogic/Object.h"
 #include "GameLogic/PartitionManager.h"
+#include "GameLogic/PathfindRequestProfile.h"
 #include "GameLogic/TerrainLogic.h"
 #include "GameLogic/Weapon.h"
 #if RETAIL_COMPATIBLE_PATHFINDING
@@ -119,7 +120,6 @@ constexpr const UnsignedInt MAX_CELL_COUNT = 500;
 constexpr const UnsignedInt MAX_ADJUSTMENT_CELL_COUNT = 400;
 constexpr const UnsignedInt MAX_SAFE_PATH_CELL_COUNT = 2000;
 
-constexpr const UnsignedInt PATHFIND_CELLS_PER_FRAME = 5000; // Number of cells we will search pathfinding per frame.
 constexpr const UnsignedInt CELL_INFOS_TO_ALLOCATE = 30000;
 
 //-----------------------------------------------------------------------------------
@@ -1221,6 +1221,8 @@ PathfindCellInfo *PathfindCellInfo::getACellInfo(PathfindCell *cell,const ICoord
 		info->m_obstacleIsFence = false;
 		info->m_obstacleIsTransparent = false;
 		info->m_blockedByAlly = false;
+		info->m_openHeapIndex = -1;
+		info->m_openSequence = 0;
 	}
 	return info;
 }
@@ -1248,6 +1250,96 @@ Bool PathfindCellList::canReverseSort(PathfindCell& currentCell) const
 	return false;
 }
 
+// The fixed pathfinding keeps the open list in a binary heap.
+static inline Bool isOpenListHeap()
+{
+#if !PATHFIND_OPEN_LIST_HEAP
+	return false;
+#elif RETAIL_COMPATIBLE_PATHFINDING
+	return s_useFixedPathfinding;
+#else
+	return true;
+#endif
+}
+
+PathfindCell* PathfindCellList::getOpenHeapCell(Int index) const
+{
+	return m_openHeap[index]->m_cell;
+}
+
+// Same order as the sorted open list: lowest total cost first, cells of equal cost in insertion order.
+Bool PathfindCellList::isOpenHeapLess(const PathfindCellInfo* a, const PathfindCellInfo* b)
+{
+	if (a->m_totalCost != b->m_totalCost)
+		return a->m_totalCost < b->m_totalCost;
+
+	return a->m_openSequence < b->m_openSequence;
+}
+
+void PathfindCellList::setOpenHeapAt(Int index, PathfindCellInfo* info)
+{
+	m_openHeap[index] = info;
+	info->m_openHeapIndex = index;
+}
+
+void PathfindCellList::siftUpOpenHeap(Int index)
+{
+	PathfindCellInfo* info = m_openHeap[index];
+	while (index > 0) {
+		Int parent = (index - 1) / 2;
+		if (!isOpenHeapLess(info, m_openHeap[parent]))
+			break;
+		setOpenHeapAt(index, m_openHeap[parent]);
+		index = parent;
+	}
+	setOpenHeapAt(index, info);
+}
+
+void PathfindCellList::siftDownOpenHeap(Int index)
+{
+	const Int count = (Int)m_openHeap.size();
+	PathfindCellInfo* info = m_openHeap[index];
+	for (;;) {
+		Int child = index * 2 + 1;
+		if (child >= count)
+			break;
+		if (child + 1 < count && isOpenHeapLess(m_openHeap[child + 1], m_openHeap[child]))
+			++child;
+		if (!isOpenHeapLess(m_openHeap[child], info))
+			break;
+		setOpenHeapAt(index, m_openHeap[child]);
+		index = child;
+	}
+	setOpenHeapAt(index, info);
+}
+
+void PathfindCellList::pushOpenHeap(PathfindCellInfo* info)
+{
+	info->m_openSequence = m_openSequence++;
+	m_openHeap.push_back(info);
+	siftUpOpenHeap((Int)m_openHeap.size() - 1);
+	m_head = m_openHeap.front()->m_cell;
+}
+
+void PathfindCellList::removeOpenHeap(PathfindCellInfo* info)
+{
+	const Int index = info->m_openHeapIndex;
+	DEBUG_ASSERTCRASH(index >= 0 && index < (Int)m_openHeap.size() && m_openHeap[index] == info, ("Cell is not in the open list heap."));
+
+	PathfindCellInfo* last = m_openHeap.back();
+	m_openHeap.pop_back();
+	info->m_openHeapIndex = -1;
+
+	if (last != info) {
+		// The removed cell may have had its cost changed already, so sift the replacement both ways.
+		setOpenHeapAt(index, last);
+		siftUpOpenHeap(index);
+		siftDownOpenHeap(last->m_openHeapIndex);
+	}
+
+	m_head = m_openHeap.empty() ? nullptr : m_openHeap.front()->m_cell;
+}
+
 //-----------------------------------------------------------------------------------
 
 /**
@@ -1729,8 +1821,9 @@ void PathfindCell::forwardInsertionSortRetailCompatible(PathfindCellList& list)
 	// insertion sort
 	PathfindCell* currentCell = list.m_head;
 	PathfindCell* previousCell = nullptr;
-	UnsignedInt cellCount = 0;
-	while (currentCell && cellCount < PATHFIND_CELLS_PER_FRAME && currentCell->m_info->m_totalCost <= m_info->m_totalCost)
+	const Int maxCellCount = max(TheAI->getAiData()->m_pathfindCellsPerFrame, 1);
+	Int cellCount = 0;
+	while (currentCell && cellCount < maxCellCount && currentCell->m_info->m_totalCost <= m_info->m_totalCost)
 	{
 		// Prevent a retail crash where a pathfindCell has an m_info with a dangling nextOpen pointer
 		if (currentCell->m_info->m_nextOpen && !currentCell->m_info->m_nextOpen->m_cell->m_info)
@@ -1870,6 +1963,19 @@ void PathfindCell::putOnSortedOpenList( PathfindCellList &list )
 	}
 #endif
 
+	if (isOpenListHeap()) {
+		DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
+		DEBUG_ASSERTCRASH(m_info->m_closed == FALSE && m_info->m_open == FALSE, ("Serious error - Invalid flags. jba"));
+
+		// mark the new cell as being on the open list
+		m_info->m_open = true;
+		m_info->m_closed = false;
+		m_info->m_prevOpen = nullptr;
+		m_info->m_nextOpen = nullptr;
+		list.pushOpenHeap(m_info);
+		return;
+	}
+
 	// TheSuperHackers @performance Mauller 20/03/2026 Implement reverse insertion sorting.
 	// Long and complex paths often append PathfindCell's, with high total path costs, to the open list.
 	// Appending and reverse traversal allow faster insertion of these cells, reducing pathfinding overhead by 50 - 66%.
@@ -1886,6 +1992,12 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+	if (isOpenListHeap()) {
+		list.removeOpenHeap(m_info);
+		m_info->m_open = false;
+		return;
+	}
+
 	if (m_info->m_nextOpen)
 		m_info->m_nextOpen->m_prevOpen = m_info->m_prevOpen;
 	else {
@@ -1907,6 +2019,20 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 Int PathfindCell::releaseOpenList( PathfindCellList &list )
 {
 	Int count = 0;
+	if (isOpenListHeap()) {
+		for (std::vector<PathfindCellInfo*>::iterator it = list.m_openHeap.begin(); it != list.m_openHeap.end(); ++it) {
+			count++;
+			PathfindCellInfo *curInfo = *it;
+			PathfindCell *cur = curInfo->m_cell;
+			DEBUG_ASSERTCRASH(curInfo->m_closed==FALSE && curInfo->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+			curInfo->m_openHeapIndex = -1;
+			curInfo->m_open = FALSE;
+			cur->releaseInfo();
+		}
+		list.reset();
+		return count;
+	}
+
 	while (list.m_head) {
 		count++;
 		DEBUG_ASSERTCRASH(list.m_head->m_info, ("Has to have info."));
@@ -2337,23 +2463,6 @@ static void flattenZones(zoneStorageType *zoneArray, zoneStorageType *zoneHierar
 #endif
 }
 
-inline void applyZone(PathfindCell &targetCell, const PathfindCell &sourceCell, zoneStorageType *zoneEquivalency, Int sizeOfZE)
-{
-	DEBUG_ASSERTCRASH(sourceCell.getZone()!=0, ("Unset source zone."));
-	Int srcZone = zoneEquivalency[sourceCell.getZone()];
-	Int targetZone = zoneEquivalency[targetCell.getZone()];
-
-	if (targetZone == 0) {
-		targetCell.setZone(srcZone);
-		return;
-	}
-	if (targetZone == srcZone) {
-		return; // already match.
-	}
-	resolveZones(srcZone, targetZone, zoneEquivalency, sizeOfZE);
-
-}
-
 inline void applyBlockZone(PathfindCell &targetCell, const PathfindCell &sourceCell,
 													 zoneStorageType *zoneEquivalency, Int firstZone, Int sizeOfZE)
 {
@@ -2368,6 +2477,102 @@ inline void applyBlockZone(PathfindCell &targetCell, const PathfindCell &sourceC
 
 }
 
+// TheSuperHackers @performance 18/10/2026 Zone equivalency tables joined by a zone link.
+enum
+{
+	ZONE_EQUIVALENCE_HIERARCHICAL		= 0x01,
+	ZONE_EQUIVALENCE_GROUND_WATER		= 0x02,
+	ZONE_EQUIVALENCE_GROUND_RUBBLE	= 0x04,
+	ZONE_EQUIVALENCE_GROUND_CLIFF		= 0x08,
+	ZONE_EQUIVALENCE_TERRAIN				= 0x10,
+	ZONE_EQUIVALENCE_CRUSHER				= 0x20
+};
+
+/* Returns the zone equivalency tables that join the zones of two adjacent cells. */
+static UnsignedByte getZoneEquivalences(const PathfindCell &thisCell, const PathfindCell &otherCell)
+{
+	UnsignedByte equivalences = 0;
+#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
+	if (thisCell.getType() == otherCell.getType()) {
+		equivalences |= ZONE_EQUIVALENCE_HIERARCHICAL;
+	}
+	if (waterGround(thisCell, otherCell)) {
+		equivalences |= ZONE_EQUIVALENCE_GROUND_WATER;
+	}
+	if (groundRubble(thisCell, otherCell)) {
+		equivalences |= ZONE_EQUIVALENCE_GROUND_RUBBLE;
+	}
+	if (groundCliff(thisCell, otherCell)) {
+		equivalences |= ZONE_EQUIVALENCE_GROUND_CLIFF;
+	}
+	if (terrain(thisCell, otherCell)) {
+		equivalences |= ZONE_EQUIVALENCE_TERRAIN;
+	}
+	if (crusherGround(thisCell, otherCell)) {
+		equivalences |= ZONE_EQUIVALENCE_CRUSHER;
+	}
+#else
+	//if this is true, skip all the ones below
+	if (thisCell.getType() == otherCell.getType())
+		return ZONE_EQUIVALENCE_HIERARCHICAL;
+
+	if (terrain(thisCell, otherCell))
+		equivalences |= ZONE_EQUIVALENCE_TERRAIN;
+
+	if (crusherGround(thisCell, otherCell))
+		equivalences |= ZONE_EQUIVALENCE_CRUSHER;
+
+	if (equivalences == 0) {
+		if (waterGround(thisCell, otherCell))
+			equivalences |= ZONE_EQUIVALENCE_GROUND_WATER;
+		else if (groundRubble(thisCell, otherCell))
+			equivalences |= ZONE_EQUIVALENCE_GROUND_RUBBLE;
+		else if (groundCliff(thisCell, otherCell))
+			equivalences |= ZONE_EQUIVALENCE_GROUND_CLIFF;
+	}
+#endif
+	return equivalences;
+}
+
+/* Returns the cell state that the zone calculation depends on, packed into a byte. */
+static UnsignedByte getCellZoneInput(const PathfindCell &cell)
+{
+	UnsignedByte input = (UnsignedByte)cell.getType();
+	if (cell.getType() == PathfindCell::CELL_OBSTACLE && cell.isObstacleFence()) {
+		input |= 0x08;
+	}
+	return input | (UnsignedByte)(cell.getConnectLayer() << 4);
+}
+
+/* Joins two zones, keeping the lower zone as the representative.  Unlike resolveZones, the table
+is only valid after flattenJoinedZones, but the final table is the same as with resolveZones,
+as both always keep the lowest zone of the joined set. */
+static void joinZones(Int zone1, Int zone2, zoneStorageType *zoneEquivalency)
+{
+	while (zoneEquivalency[zone1] != zone1) {
+		zoneEquivalency[zone1] = zoneEquivalency[zoneEquivalency[zone1]];
+		zone1 = zoneEquivalency[zone1];
+	}
+	while (zoneEquivalency[zone2] != zone2) {
+		zoneEquivalency[zone2] = zoneEquivalency[zoneEquivalency[zone2]];
+		zone2 = zoneEquivalency[zone2];
+	}
+	if (zone1 < zone2) {
+		zoneEquivalency[zone2] = zone1;
+	} else if (zone2 < zone1) {
+		zoneEquivalency[zone1] = zone2;
+	}
+}
+
+static void flattenJoinedZones(zoneStorageType *zoneEquivalency, Int sizeOfZE)
+{
+	// Joined zones always point to a lower zone, so a single ascending pass resolves them all.
+	Int i;
+	for (i=0; i<sizeOfZE; i++) {
+		zoneEquivalency[i] = zoneEquivalency[zoneEquivalency[i]];
+	}
+}
+
 //------------------------  ZoneBlock  -------------------------------
 ZoneBlock::ZoneBlock() : m_firstZone(0),
 m_numZones(0),
@@ -2382,6 +2587,10 @@ m_interactsWithBridge(FALSE)
 	m_cellOrigin.y = 0;
 	m_firstZone = 0;
 	m_markedPassable = TRUE;
+	m_numLocalZones = 0;
+	m_cellsInteractWithBridge = false;
+	m_localZonesChanged = false;
+	m_zoneLinksDirty = true;
 }
 
 ZoneBlock::~ZoneBlock()
@@ -2473,6 +2682,44 @@ void ZoneBlock::blockCalculateZones(PathfindCell **map, PathfindLayer layers[],
 
 }
 
+/* Shift all zones of this block by delta.  Used when the zones of a preceding block changed, but
+the cells of this block did not. */
+void ZoneBlock::offsetZones(Int delta)
+{
+	m_firstZone += delta;
+	if (m_groundCliffZones == nullptr) {
+		return;
+	}
+	Int i;
+	for (i=0; i<m_zonesAllocated; i++) {
+		m_groundCliffZones[i] += delta;
+		m_groundWaterZones[i] += delta;
+		m_groundRubbleZones[i] += delta;
+		m_crusherZones[i] += delta;
+	}
+}
+
+/* Add a link between two zones, merging it with an existing link between the same zones. */
+void ZoneBlock::addZoneLink(Int zone, Int otherZone, ZoneLinkType linkType, UnsignedByte equivalences)
+{
+	if (equivalences == 0) {
+		return;
+	}
+	ZoneLinkVector::iterator it;
+	for (it = m_zoneLinks.begin(); it != m_zoneLinks.end(); ++it) {
+		if (it->m_zone == zone && it->m_otherZone == otherZone && it->m_linkType == linkType) {
+			it->m_equivalences |= equivalences;
+			return;
+		}
+	}
+	ZoneLink link;
+	link.m_zone = (UnsignedByte)zone;
+	link.m_otherZone = (UnsignedByte)otherZone;
+	link.m_linkType = (UnsignedByte)linkType;
+	link.m_equivalences = equivalences;
+	m_zoneLinks.push_back(link);
+}
+
 //
 // Return the zone at this location.
 //
@@ -2578,6 +2825,8 @@ m_crusherZones(nullptr),
 m_hierarchicalZones(nullptr),
 m_blockOfZoneBlocks(nullptr),
 m_zoneBlocks(nullptr),
+m_cellZoneInputs(nullptr),
+m_cellLocalZones(nullptr),
 m_zonesAllocated(0)
 {
 	m_zoneBlockExtent.x = 0;
@@ -2621,6 +2870,12 @@ void PathfindZoneManager::freeBlocks()
 	delete [] m_zoneBlocks;
 	m_zoneBlocks = nullptr;
 
+	delete [] m_cellZoneInputs;
+	m_cellZoneInputs = nullptr;
+
+	delete [] m_cellLocalZones;
+	m_cellLocalZones = nullptr;
+
 	m_zoneBlockExtent.x = 0;
 	m_zoneBlockExtent.y = 0;
 }
@@ -2664,6 +2919,199 @@ void PathfindZoneManager::allocateBlocks(const IRegion2D &globalBounds)
 	for (i=0; i<m_zoneBlockExtent.x; i++) {
 		m_zoneBlocks[i] = &m_blockOfZoneBlocks[i*(m_zoneBlockExtent.y)];
 	}
+
+	m_cellBounds = globalBounds;
+	Int numCells = (globalBounds.hi.x-globalBounds.lo.x+1)*(globalBounds.hi.y-globalBounds.lo.y+1);
+	m_cellZoneInputs = MSGNEW("PathfindZoneBlocks") UnsignedByte[numCells];
+	m_cellLocalZones = MSGNEW("PathfindZoneBlocks") UnsignedByte[numCells];
+	// No cell matches this input, so the first calculation calculates all blocks.
+	memset(m_cellZoneInputs, 0xff, numCells);
+	memset(m_cellLocalZones, 0, numCells);
+}
+
+/* Get the inclusive cell bounds of a zone block. */
+void PathfindZoneManager::getBlockBounds(Int xBlock, Int yBlock, const IRegion2D &globalBounds, IRegion2D &bounds) const
+{
+	bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
+	bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
+	bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	if (bounds.hi.x > globalBounds.hi.x) {
+		bounds.hi.x = globalBounds.hi.x;
+	}
+	if (bounds.hi.y > globalBounds.hi.y) {
+		bounds.hi.y = globalBounds.hi.y;
+	}
+}
+
+/* Store the zone inputs of the cells in bounds.  Returns true if any of them changed since the
+last zone calculation. */
+Bool PathfindZoneManager::updateCellZoneInputs(PathfindCell **map, const IRegion2D &bounds)
+{
+	Bool changed = false;
+	Int i, j;
+	for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+		UnsignedByte *inputs = &m_cellZoneInputs[getCellIndex(i, bounds.lo.y)];
+		for( j=bounds.lo.y; j<=bounds.hi.y; j++, inputs++ )	{
+			UnsignedByte input = getCellZoneInput(map[i][j]);
+			if (*inputs != input) {
+				*inputs = input;
+				changed = true;
+			}
+		}
+	}
+	return changed;
+}
+
+/* Label the cells of a block with zones local to the block.  Local zones are numbered in the order
+they are first found, which is the same order calculateZones numbers them in, so the zone of a
+cell is the first zone of its block plus its local zone. */
+void PathfindZoneManager::calculateLocalZones(PathfindCell **map, const IRegion2D &bounds, ZoneBlock &block)
+{
+	const Int maxLocalZones = ZONE_BLOCK_SIZE*ZONE_BLOCK_SIZE+1;
+	UnsignedByte zoneEquivalency[maxLocalZones];
+	Int numZones = 1;	// local zone 0 is a flag while labelling.
+	Bool interactsWithBridge = false;
+	Int i, j, k;
+
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			const PathfindCell &cell = map[i][j];
+			Int zone = 0;
+			if (i>bounds.lo.x && cell.getType() == map[i-1][j].getType()) {
+				zone = zoneEquivalency[m_cellLocalZones[getCellIndex(i-1, j)]];
+			}
+			if (j>bounds.lo.y && cell.getType() == map[i][j-1].getType()) {
+				Int topZone = zoneEquivalency[m_cellLocalZones[getCellIndex(i, j-1)]];
+				if (zone == 0) {
+					zone = topZone;
+				} else if (zone != topZone) {
+					// We have two zones being combined now. Keep the lower zone.
+					Int lowZone = MIN(zone, topZone);
+					Int highZone = MAX(zone, topZone);
+					for (k=1; k<numZones; k++) {
+						if (zoneEquivalency[k] == highZone) {
+							zoneEquivalency[k] = lowZone;
+						}
+					}
+					zone = lowZone;
+				}
+			}
+			if (zone == 0) {
+				zone = numZones;
+				zoneEquivalency[numZones] = numZones;
+				numZones++;
+			}
+			m_cellLocalZones[getCellIndex(i, j)] = zone;
+			if (cell.getConnectLayer() > LAYER_GROUND) {
+				interactsWithBridge = true;
+			}
+		}
+	}
+
+	// Collapse the zones into a 0,1,2... sequence, removing collapsed zones.
+	UnsignedByte collapsedZones[maxLocalZones];
+	Int numLocalZones = 0;
+	for (k=1; k<numZones; k++) {
+		Int zone = zoneEquivalency[k];
+		if (zone == k) {
+			collapsedZones[k] = numLocalZones;
+			++numLocalZones;
+		} else {
+			collapsedZones[k] = collapsedZones[zone];
+		}
+	}
+	for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+		UnsignedByte *localZones = &m_cellLocalZones[getCellIndex(i, bounds.lo.y)];
+		for( j=bounds.lo.y; j<=bounds.hi.y; j++, localZones++ )	{
+			*localZones = collapsedZones[*localZones];
+		}
+	}
+
+	block.m_numLocalZones = numLocalZones;
+	block.m_cellsInteractWithBridge = interactsWithBridge;
+	block.m_localZonesChanged = true;
+}
+
+/* Rebuild the links of a block to its own zones, the blocks to the left and top, and the bridge layers. */
+void PathfindZoneManager::calculateZoneLinks(PathfindCell **map, const IRegion2D &bounds, const IRegion2D &globalBounds, ZoneBlock &block)
+{
+	block.m_zoneLinks.clear();
+	Int i, j;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			const PathfindCell &cell = map[i][j];
+			Int zone = m_cellLocalZones[getCellIndex(i, j)];
+
+			if (cell.getConnectLayer() > LAYER_GROUND && cell.getType() == PathfindCell::CELL_CLEAR) {
+				block.addZoneLink(zone, cell.getConnectLayer(), ZoneBlock::ZONE_LINK_LAYER, ZONE_EQUIVALENCE_HIERARCHICAL);
+			}
+
+			if (i > globalBounds.lo.x) {
+				Int leftZone = m_cellLocalZones[getCellIndex(i-1, j)];
+				if (i > bounds.lo.x) {
+					if (zone != leftZone) {
+						block.addZoneLink(zone, leftZone, ZoneBlock::ZONE_LINK_INTERNAL, getZoneEquivalences(cell, map[i-1][j]));
+					}
+				} else {
+					block.addZoneLink(zone, leftZone, ZoneBlock::ZONE_LINK_LEFT, getZoneEquivalences(cell, map[i-1][j]));
+				}
+			}
+
+			if (j > globalBounds.lo.y) {
+				Int topZone = m_cellLocalZones[getCellIndex(i, j-1)];
+				if (j > bounds.lo.y) {
+					if (zone != topZone) {
+						block.addZoneLink(zone, topZone, ZoneBlock::ZONE_LINK_INTERNAL, getZoneEquivalences(cell, map[i][j-1]));
+					}
+				} else {
+					block.addZoneLink(zone, topZone, ZoneBlock::ZONE_LINK_TOP, getZoneEquivalences(cell, map[i][j-1]));
+				}
+			}
+		}
+	}
+	block.m_zoneLinksDirty = false;
+}
+
+/* Join the zone equivalency tables along the links of a block. */
+void PathfindZoneManager::applyZoneLinks(PathfindLayer layers[], Int xBlock, Int yBlock)
+{
+	const ZoneBlock &block = m_zoneBlocks[xBlock][yBlock];
+	const Int firstZone = block.getFirstZone();
+	ZoneBlock::ZoneLinkVector::const_iterator it;
+	for (it = block.m_zoneLinks.begin(); it != block.m_zoneLinks.end(); ++it) {
+		Int zone = firstZone + it->m_zone;
+		Int otherZone;
+		switch (it->m_linkType)
+		{
+			case ZoneBlock::ZONE_LINK_INTERNAL:
+				otherZone = firstZone + it->m_otherZone;
+				break;
+			case ZoneBlock::ZONE_LINK_LEFT:
+				otherZone = m_zoneBlocks[xBlock-1][yBlock].getFirstZone() + it->m_otherZone;
+				break;
+			case ZoneBlock::ZONE_LINK_TOP:
+				otherZone = m_zoneBlocks[xBlock][yBlock-1].getFirstZone() + it->m_otherZone;
+				break;
+			default:
+				otherZone = layers[it->m_otherZone].getZone();
+				break;
+		}
+
+		const UnsignedByte equivalences = it->m_equivalences;
+		if (equivalences & ZONE_EQUIVALENCE_HIERARCHICAL)
+			joinZones(zone, otherZone, m_hierarchicalZones);
+		if (equivalences & ZONE_EQUIVALENCE_GROUND_WATER)
+			joinZones(zone, otherZone, m_groundWaterZones);
+		if (equivalences & ZONE_EQUIVALENCE_GROUND_RUBBLE)
+			joinZones(zone, otherZone, m_groundRubbleZones);
+		if (equivalences & ZONE_EQUIVALENCE_GROUND_CLIFF)
+			joinZones(zone, otherZone, m_groundCliffZones);
+		if (equivalences & ZONE_EQUIVALENCE_TERRAIN)
+			joinZones(zone, otherZone, m_terrainZones);
+		if (equivalences & ZONE_EQUIVALENCE_CRUSHER)
+			joinZones(zone, otherZone, m_crusherZones);
+	}
 }
 
 void PathfindZoneManager::reset()  ///< Called when the map is reset.
@@ -2707,107 +3155,70 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 #endif
 #endif
 
-	m_maxZone = 1;	// we start using zone 0 as a flag.
-	const Int maxZones=24000;
-	zoneStorageType zoneEquivalency[maxZones];
+	// TheSuperHackers @performance 18/10/2026 Zones are now calculated incrementally. Only the zone
+	// blocks whose cells changed since the last calculation are relabelled, and the zone equivalencies
+	// are joined along the cached zone links of each block instead of rescanning the whole map. The
+	// resulting zones and equivalency tables are identical to a full calculation.
 	Int i, j;
-	for (i=0; i<maxZones; i++) {
-		zoneEquivalency[i] = i;
-	}
 	for (i=0; i<=LAYER_LAST; i++) {
 		layers[i].setZone(0);
 	}
 
-	Int xCount = (globalBounds.hi.x-globalBounds.lo.x+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
-	Int yCount = (globalBounds.hi.y-globalBounds.lo.y+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
+	const Int xCount = m_zoneBlockExtent.x;
+	const Int yCount = m_zoneBlockExtent.y;
 
 	Int xBlock, yBlock;
 	for (xBlock = 0; xBlock<xCount; xBlock++) {
 		for (yBlock=0; yBlock<yCount; yBlock++) {
 			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			if (bounds.hi.x > globalBounds.hi.x) {
-				bounds.hi.x = globalBounds.hi.x;
-			}
-			if (bounds.hi.y > globalBounds.hi.y) {
-				bounds.hi.y = globalBounds.hi.y;
-			}
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-			if (bounds.lo.x>bounds.hi.x || bounds.lo.y>bounds.hi.y) {
-				DEBUG_CRASH(("Incorrect bounds calculation. Logic error, fix me. jba."));
-				continue;
+			getBlockBounds(xBlock, yBlock, globalBounds, bounds);
+			ZoneBlock &block = m_zoneBlocks[xBlock][yBlock];
+			block.m_localZonesChanged = false;
+			if (updateCellZoneInputs(map, bounds)) {
+				calculateLocalZones(map, bounds, block);
+				// The links of the blocks to the right and bottom reference the cells of this block.
+				block.m_zoneLinksDirty = true;
+				if (xBlock+1 < xCount) {
+					m_zoneBlocks[xBlock+1][yBlock].m_zoneLinksDirty = true;
+				}
+				if (yBlock+1 < yCount) {
+					m_zoneBlocks[xBlock][yBlock+1].m_zoneLinksDirty = true;
+				}
 			}
-#endif
-			m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(false);
-			for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
-				for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
-					PathfindCell *cell = &map[i][j];
-					cell->setZone(0);
+		}
+	}
 
-					if (i>bounds.lo.x) {
-						if (map[i][j].getType() == map[i-1][j].getType()) {
-							applyZone(map[i][j], map[i-1][j], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (j>bounds.lo.y) {
-						if (map[i][j].getType() == map[i][j-1].getType()) {
-							applyZone(map[i][j], map[i][j-1], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (cell->getZone()==0) {
-						cell->setZone(m_maxZone);
-						m_maxZone++;
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-						if (m_maxZone>= maxZones) {
-							DEBUG_CRASH(("Ran out of pathfind zones.  SERIOUS ERROR! jba."));
-							break;
-						}
-#endif
-					}
-					if (cell->getConnectLayer() > LAYER_GROUND) {
- 						m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(true);
-					}
+	// Number the zones block by block, and map the local zones in the map back into them.
+	m_maxZone = 1;	// we start using zone 0 as a flag.
+	for (xBlock = 0; xBlock<xCount; xBlock++) {
+		for (yBlock=0; yBlock<yCount; yBlock++) {
+			IRegion2D bounds;
+			getBlockBounds(xBlock, yBlock, globalBounds, bounds);
+			ZoneBlock &block = m_zoneBlocks[xBlock][yBlock];
+			const Int firstZone = m_maxZone;
+			m_maxZone += block.m_numLocalZones;
 
+			for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+				const UnsignedByte *localZones = &m_cellLocalZones[getCellIndex(i, bounds.lo.y)];
+				for( j=bounds.lo.y; j<=bounds.hi.y; j++, localZones++ )	{
+					map[i][j].setZone(firstZone + *localZones);
 				}
 			}
- 		}
-	}
-
-	Int totalZones = m_maxZone;
 
-	// Collapse the zones into a 1,2,3... sequence, removing collapsed zones.
-	m_maxZone = 1;
-	Int collapsedZones[maxZones];
-	collapsedZones[0] = 0;
-	for (i=1; i<totalZones; i++) {
-		Int zone = zoneEquivalency[i];
-		if (zone == i) {
-			collapsedZones[i] = m_maxZone;
-			++m_maxZone;
-		} else {
-			collapsedZones[i] = collapsedZones[zone];
+			block.setInteractsWithBridge(block.m_cellsInteractWithBridge);
+			if (block.m_localZonesChanged) {
+				block.blockCalculateZones(map, layers, bounds);
+			} else if (block.getFirstZone() != firstZone) {
+				block.offsetZones(firstZone - block.getFirstZone());
+			}
 		}
 	}
 
-	// Now map the zones in the map back into the collapsed zones.
-	for( j=globalBounds.lo.y; j<=globalBounds.hi.y; j++ ) {
-		for( i=globalBounds.lo.x; i<=globalBounds.hi.x; i++ ) {
-			PathfindCell &cell = map[i][j];
-			cell.setZone(collapsedZones[cell.getZone()]);
-		}
-	}
-	
 	for (i=0; i<=LAYER_LAST; i++) {
 		PathfindLayer &r_thisLayer = layers[i];
 
-		Int zone = collapsedZones[r_thisLayer.getZone()];
-		if (zone == 0) {
-			zone = m_maxZone;
-			m_maxZone++;
-		}
+		Int zone = m_maxZone;
+		m_maxZone++;
 
 		r_thisLayer.setZone( zone );
 		r_thisLayer.applyZone();
@@ -2823,29 +3234,6 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 
 	allocateZones();
 
-	for (xBlock=0; xBlock<xCount; xBlock++) {
-		for (yBlock=0; yBlock<yCount; yBlock++) {
-			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-
-			if (bounds.hi.x > globalBounds.hi.x)
-				bounds.hi.x = globalBounds.hi.x;
-
-			if (bounds.hi.y > globalBounds.hi.y)
-				bounds.hi.y = globalBounds.hi.y;
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-			if (bounds.lo.x>bounds.hi.x || bounds.lo.y>bounds.hi.y) {
-				DEBUG_CRASH(("Incorrect bounds calculation. Logic error, fix me. jba."));
-				continue;
-			}
-#endif
-			m_zoneBlocks[xBlock][yBlock].blockCalculateZones(map, layers, bounds);
-		}
-	}
-
 	// Determine water/ground equivalent zones, and ground/cliff equivalent zones.
 	for (i=0; i<m_zonesAllocated; i++) {
 		m_groundCliffZones[i] = i;
@@ -2856,125 +3244,25 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 		m_hierarchicalZones[i] = i;
 	}
 
-	for( j=globalBounds.lo.y; j<=globalBounds.hi.y; j++ ) {
-		for( i=globalBounds.lo.x; i<=globalBounds.hi.x; i++ ) {
-			PathfindCell &r_thisCell = map[i][j];
-
-			if ( (r_thisCell.getConnectLayer() > LAYER_GROUND) &&
-				(r_thisCell.getType() == PathfindCell::CELL_CLEAR) ) {
-				PathfindLayer *layer = layers + r_thisCell.getConnectLayer();
-				resolveZones(r_thisCell.getZone(), layer->getZone(), m_hierarchicalZones, m_maxZone);
-			}
-
-			if ( i > globalBounds.lo.x && r_thisCell.getZone() != map[i-1][j].getZone() ) {
-				const PathfindCell &r_leftCell = map[i-1][j];
-
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-				if (r_thisCell.getType() == r_leftCell.getType()) {
-					applyZone(r_thisCell, r_leftCell, m_hierarchicalZones, m_maxZone);
-				}
-				if (waterGround(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_groundWaterZones, m_maxZone);
-				}
-				if (groundRubble(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_groundRubbleZones, m_maxZone);
-				}
-				if (groundCliff(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_groundCliffZones, m_maxZone);
-				}
-				if (terrain(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_terrainZones, m_maxZone);
-				}
-				if (crusherGround(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_crusherZones, m_maxZone);
-				}
-#else
-				//if this is true, skip all the ones below
-				if (r_thisCell.getType() == r_leftCell.getType())
-					applyZone(r_thisCell, r_leftCell, m_hierarchicalZones, m_maxZone);
-				else {
-					Bool notTerrainOrCrusher = TRUE; // if this is false, skip the if-else-ladder below
-
-					if (terrain(r_thisCell, r_leftCell)) {
-						applyZone(r_thisCell, r_leftCell, m_terrainZones, m_maxZone);
-						notTerrainOrCrusher = FALSE;
-					}
-
-					if (crusherGround(r_thisCell, r_leftCell)) {
-						applyZone(r_thisCell, r_leftCell, m_crusherZones, m_maxZone);
-						notTerrainOrCrusher = FALSE;
-					}
-
-					if ( notTerrainOrCrusher ) {
-						if (waterGround(r_thisCell, r_leftCell))
-							applyZone(r_thisCell, r_leftCell, m_groundWaterZones, m_maxZone);
-						else if (groundRubble(r_thisCell, r_leftCell))
-							applyZone(r_thisCell, r_leftCell, m_groundRubbleZones, m_maxZone);
-						else if (groundCliff(r_thisCell, r_leftCell))
-							applyZone(r_thisCell, r_leftCell, m_groundCliffZones, m_maxZone);
-					}
-
-				}
-#endif
-
-			}
-
-			if (j>globalBounds.lo.y && r_thisCell.getZone()!=map[i][j-1].getZone()) {
-				const PathfindCell &r_topCell = map[i][j-1];
-
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-				if (r_thisCell.getType() == r_topCell.getType()) {
-					applyZone(r_thisCell, r_topCell, m_hierarchicalZones, m_maxZone);
-				}
-				if (waterGround(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_groundWaterZones, m_maxZone);
-				}
-				if (groundRubble(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_groundRubbleZones, m_maxZone);
-				}
-				if (groundCliff(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_groundCliffZones, m_maxZone);
-				}
-				if (terrain(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_terrainZones, m_maxZone);
-				}
-				if (crusherGround(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_crusherZones, m_maxZone);
-				}
-#else
-				//if this is true, skip all the ones below
-				if (r_thisCell.getType() == r_topCell.getType())
-					applyZone(r_thisCell, r_topCell, m_hierarchicalZones, m_maxZone);
-				else {
-					Bool notTerrainOrCrusher = TRUE; // if this is false, skip the if-else-ladder below
-
-					if (terrain(r_thisCell, r_topCell)) {
-						applyZone(r_thisCell, r_topCell, m_terrainZones, m_maxZone);
-						notTerrainOrCrusher = FALSE;
-					}
-
-					if (crusherGround(r_thisCell, r_topCell)) {
-						applyZone(r_thisCell, r_topCell, m_crusherZones, m_maxZone);
-						notTerrainOrCrusher = FALSE;
-					}
-
-					if (notTerrainOrCrusher) {
-						if (waterGround(r_thisCell, r_topCell))
-							applyZone(r_thisCell, r_topCell, m_groundWaterZones, m_maxZone);
-						else if (groundRubble(r_thisCell, r_topCell))
-							applyZone(r_thisCell, r_topCell, m_groundRubbleZones, m_maxZone);
-						else if (groundCliff(r_thisCell, r_topCell))
-							applyZone(r_thisCell, r_topCell, m_groundCliffZones, m_maxZone);
-					}
-
-				}
-#endif
-
+	for (xBlock = 0; xBlock<xCount; xBlock++) {
+		for (yBlock=0; yBlock<yCount; yBlock++) {
+			ZoneBlock &block = m_zoneBlocks[xBlock][yBlock];
+			if (block.m_zoneLinksDirty) {
+				IRegion2D bounds;
+				getBlockBounds(xBlock, yBlock, globalBounds, bounds);
+				calculateZoneLinks(map, bounds, globalBounds, block);
 			}
-
+			applyZoneLinks(layers, xBlock, yBlock);
 		}
 	}
 
+	flattenJoinedZones(m_hierarchicalZones, m_maxZone);
+	flattenJoinedZones(m_groundWaterZones, m_maxZone);
+	flattenJoinedZones(m_groundRubbleZones, m_maxZone);
+	flattenJoinedZones(m_groundCliffZones, m_maxZone);
+	flattenJoinedZones(m_terrainZones, m_maxZone);
+	flattenJoinedZones(m_crusherZones, m_maxZone);
+
 	//FLATTEN HIERARCHICAL ZONES
 	for (i=1; i<m_maxZone; i++) {
 		Int zone = m_hierarchicalZones[i];
@@ -4092,6 +4380,7 @@ void Pathfinder::reset()
 	// pathfind grid cells have not been classified yet
 	m_isMapReady = false;
 	m_cumulativeCellsAllocated = 0;
+	m_queueCellDebt = 0;
 
 	debugPathPos.x = 0.0f;
 	debugPathPos.y = 0.0f;
@@ -4917,8 +5206,15 @@ void Pathfinder::debugShowSearch(  Bool pathFound  )
 		addIcon(nullptr, 0, 0, color);	 // erase.
 	}
 
-	for( s = m_openList.getHead(); s; s=s->getNextOpen() )
+	for( Int openIndex = 0; ; ++openIndex )
 	{
+		if (isOpenListHeap())
+			s = openIndex < m_openList.getOpenHeapSize() ? m_openList.getOpenHeapCell(openIndex) : nullptr;
+		else
+			s = openIndex == 0 ? m_openList.getHead() : s->getNextOpen();
+		if (!s)
+			break;
+
 		// create objects to show path - they decay
 		RGBColor color;
 		color.red = color.green = 0;
@@ -6099,16 +6395,41 @@ void Pathfinder::processPathfindQueue()
 	bounds.hi.y--;
 	m_logicalExtent = bounds;
 
+	// TheSuperHackers @performance 18/10/2026 The cell budget per frame is set from AIData.
+	// The queue resumes at the first request that did not fit into the budget of the previous frame. A single
+	// long search is not suspended in the middle, because the searches share the cell infos and the open and
+	// closed lists with the synchronous pathfind calls made between two queue updates. With
+	// PathfindCarryOverCells the cells examined beyond the budget are taken from the budget of the next frames
+	// instead, so that a burst of requests is spread evenly over the following frames. The queue order is
+	// unchanged and the budget only depends on logic state, so this stays deterministic.
+	const TAiData *aiData = TheAI->getAiData();
+	Int cellBudget = max(aiData->m_pathfindCellsPerFrame, 1);
+	if (aiData->m_pathfindCarryOverCells) {
+		cellBudget -= m_queueCellDebt;
+	}
+
 	m_cumulativeCellsAllocated = 0;	// Number of pathfind cells examined.
 	Int pathsFound = 0;
-	while (m_cumulativeCellsAllocated < PATHFIND_CELLS_PER_FRAME &&
+	while (m_cumulativeCellsAllocated < cellBudget &&
 		m_queuePRTail!=m_queuePRHead) {
 		Object *obj = TheGameLogic->findObjectByID(m_queuedPathfindRequests[m_queuePRHead]);
 		m_queuedPathfindRequests[m_queuePRHead] = INVALID_ID;
 		if (obj) {
 			AIUpdateInterface *ai = obj->getAIUpdateInterface();
 			if (ai) {
-				ai->doPathfind(this);
+				if (ThePathfindRequestProfile) {
+					Int radius;
+					Bool centerInCell;
+					getRadiusAndCenter(obj, radius, centerInCell);
+					ThePathfindRequestProfile->beginRequest(TheGameLogic->getFrame(), obj->getID(),
+						ai->getLocomotorSet().getValidSurfaces(), centerInCell ? radius*2+1 : radius*2,
+						obj->getCrusherLevel() > 0, *obj->getPosition(), obj->getLayer(), *ai->friend_getRequestedDestination());
+					const Int cellsBefore = m_cumulativeCellsAllocated;
+					ai->doPathfind(this);
+					ThePathfindRequestProfile->endRequest(ai->getPath(), m_cumulativeCellsAllocated - cellsBefore);
+				} else {
+					ai->doPathfind(this);
+				}
 				pathsFound++;
 			}
 		}
@@ -6117,6 +6438,9 @@ void Pathfinder::processPathfindQueue()
 			m_queuePRHead = 0;
 		}
 	}
+	if (aiData->m_pathfindCarryOverCells) {
+		m_queueCellDebt = max(m_cumulativeCellsAllocated - cellBudget, 0);
+	}
 	if (pathsFound > 0) {
 		PROFILER_PLOT("PathfindCells", (double)m_cumulativeCellsAllocated);
 		PROFILER_PLOT("PathfindPaths", (double)pathsFound);
@@ -6527,6 +6851,9 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 Path *Pathfinder::findPath( Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
 													 const Coord3D *rawTo)
 {
+	if (ThePathfindRequestProfile)
+		ThePathfindRequestProfile->addRequestKind(PATHFIND_REQUEST_FIND_PATH);
+
 	if (!clientSafeQuickDoesPathExist(locomotorSet, from, rawTo)) {
 		return nullptr;
 	}
@@ -8753,6 +9080,9 @@ Int Pathfinder::checkPathCost(Object *obj, const LocomotorSet& locomotorSet, con
 Path *Pathfinder::findClosestPath( Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
 																	Coord3D *rawTo, Bool blocked, Real pathCostMultiplier, Bool moveAllies)
 {
+	if (ThePathfindRequestProfile)
+		ThePathfindRequestProfile->addRequestKind(PATHFIND_REQUEST_FIND_CLOSEST_PATH);
+
 	//CRCDEBUG_LOG(("Pathfinder::findClosestPath()"));
 #ifdef DEBUG_LOGGING
 	Int startTimeMS = ::GetTickCount();
@@ -10865,6 +11195,9 @@ Path *Pathfinder::patchPath( const Object *obj, const LocomotorSet& locomotorSet
 Path *Pathfinder::findAttackPath( const Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
 		const Object *victim, const Coord3D* victimPos, const Weapon *weapon )
 {
+	if (ThePathfindRequestProfile)
+		ThePathfindRequestProfile->addRequestKind(PATHFIND_REQUEST_FIND_ATTACK_PATH);
+
 	if (!m_isMapReady)
 		return nullptr; // Should always be ok.
 
@@ -11221,6 +11554,8 @@ Path *Pathfinder::findSafePath( const Object *obj, const LocomotorSet& locomotor
 		const Coord3D *from, const Coord3D* repulsorPos1, const Coord3D* repulsorPos2, Real repulsorRadius)
 {
 	//CRCDEBUG_LOG(("Pathfinder::findSafePath()"));
+	if (ThePathfindRequestProfile)
+		ThePathfindRequestProfile->addRequestKind(PATHFIND_REQUEST_FIND_SAFE_PATH);
 	if (m_isMapReady == false) return nullptr; // Should always be ok.
 #if defined(RTS_DEBUG)
 //	Int startTimeMS = ::GetTickCount();
@@ -11449,18 +11784,45 @@ void Pathfinder::crc( Xfer *xfer )
 	CRCDEBUG_LOG(("m_wallHeight: %8.8X", ((XferCRC *)xfer)->getCRC()));
 	xfer->xferInt(&m_cumulativeCellsAllocated);
 	CRCDEBUG_LOG(("m_cumulativeCellsAllocated: %8.8X", ((XferCRC *)xfer)->getCRC()));
+	// TheSuperHackers @performance 18/10/2026 Only when it is used, so that the CRC does not change otherwise.
+	if (TheAI->getAiData()->m_pathfindCarryOverCells)
+	{
+		xfer->xferInt(&m_queueCellDebt);
+		CRCDEBUG_LOG(("m_queueCellDebt: %8.8X", ((XferCRC *)xfer)->getCRC()));
+	}
 
 }
 
+//-----------------------------------------------------------------------------
+/** Xfer method
+	* Version Info:
+	* 1: Initial version
+	* 2: TheSuperHackers @performance 18/10/2026 m_queueCellDebt
+	* 3: TheSuperHackers @fix 18/10/2026 The pathfind queue and m_cumulativeCellsAllocated, for replay snapshots
+	*/
 //-----------------------------------------------------------------------------
 void Pathfinder::xfer( Xfer *xfer )
 {
 
 	// version
-	XferVersion currentVersion = 1;
+	XferVersion currentVersion = 3;
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
+	if (version >= 2)
+	{
+		xfer->xferInt(&m_queueCellDebt);
+	}
+
+	// The queue is not rebuilt from the waiting AIUpdates on load, and it is part of the CRC.
+	if (version >= 3)
+	{
+		xfer->xferUser(m_queuedPathfindRequests, sizeof(ObjectID)*PATHFIND_QUEUE_LEN);
+		xfer->xferInt(&m_queuePRHead);
+		xfer->xferInt(&m_queuePRTail);
+		xfer->xferInt(&m_cumulativeCellsAllocated);
+	}
+
 }
 
 //-----------------------------------------------------------------------------
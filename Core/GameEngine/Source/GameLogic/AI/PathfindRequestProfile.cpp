@@ -0,0 +1,169 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "GameLogic/PathfindRequestProfile.h"
+
+#include "GameLogic/AIPathfind.h"
+
+
+PathfindRequestProfile* ThePathfindRequestProfile = nullptr;
+
+// FNV-1a
+static const UnsignedInt PATH_HASH_SEED = 2166136261u;
+
+static inline UnsignedInt hashValue(UnsignedInt hash, UnsignedInt value)
+{
+	for (Int i = 0; i < 4; ++i)
+	{
+		hash ^= (value >> (i * 8)) & 0xff;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+static inline UnsignedInt realBits(Real value)
+{
+	UnsignedInt bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+PathfindRequestProfile::PathfindRequestProfile()
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	m_freq = freq.QuadPart;
+	m_file = nullptr;
+	m_requestStart = 0;
+	memset(&m_request, 0, sizeof(m_request));
+	m_requestKinds = 0;
+	m_combinedHash = PATH_HASH_SEED;
+	m_totalCells = 0;
+}
+
+PathfindRequestProfile::~PathfindRequestProfile()
+{
+	close();
+}
+
+Bool PathfindRequestProfile::open(const char* filename)
+{
+	close();
+	m_file = fopen(filename, "wt");
+	if (m_file == nullptr)
+		return FALSE;
+
+	fprintf(m_file, "frame,object,kinds,surfaces,diameter,crusher,from_x,from_y,from_z,from_layer,to_x,to_y,to_z,cells,time_us,nodes,path_hash\n");
+	return TRUE;
+}
+
+void PathfindRequestProfile::close()
+{
+	if (m_file != nullptr)
+	{
+		fclose(m_file);
+		m_file = nullptr;
+	}
+}
+
+Int64 PathfindRequestProfile::getTicks() const
+{
+	LARGE_INTEGER tick;
+	QueryPerformanceCounter(&tick);
+	return tick.QuadPart;
+}
+
+UnsignedInt PathfindRequestProfile::toMicroseconds(Int64 ticks) const
+{
+	return static_cast<UnsignedInt>(ticks * 1000000 / m_freq);
+}
+
+// Hashes the exact bit patterns of the path nodes, so that equal hashes mean identical paths.
+UnsignedInt PathfindRequestProfile::hashPath(Path* path, Int& nodeCount)
+{
+	nodeCount = 0;
+	if (path == nullptr)
+		return 0;
+
+	UnsignedInt hash = PATH_HASH_SEED;
+	for (PathNode* node = path->getFirstNode(); node != nullptr; node = node->getNext())
+	{
+		const Coord3D* pos = node->getPosition();
+		hash = hashValue(hash, realBits(pos->x));
+		hash = hashValue(hash, realBits(pos->y));
+		hash = hashValue(hash, realBits(pos->z));
+		hash = hashValue(hash, (UnsignedInt)node->getLayer());
+		++nodeCount;
+	}
+	return hash;
+}
+
+void PathfindRequestProfile::beginRequest(UnsignedInt frame, ObjectID objectID, UnsignedInt surfaces, Int diameter, Bool crusher,
+	const Coord3D& from, Int fromLayer, const Coord3D& to)
+{
+	m_request.frame = frame;
+	m_request.objectID = objectID;
+	m_request.surfaces = surfaces;
+	m_request.diameter = diameter;
+	m_request.crusher = crusher;
+	m_request.from = from;
+	m_request.fromLayer = fromLayer;
+	m_request.to = to;
+	m_requestKinds = 0;
+	m_requestStart = getTicks();
+}
+
+void PathfindRequestProfile::endRequest(Path* path, Int cellsExamined)
+{
+	const UnsignedInt time = toMicroseconds(getTicks() - m_requestStart);
+
+	Int nodeCount;
+	const UnsignedInt pathHash = hashPath(path, nodeCount);
+	m_combinedHash = hashValue(m_combinedHash, pathHash);
+	m_totalCells += cellsExamined;
+	m_latencies.push_back(time);
+
+	if (m_file == nullptr)
+		return;
+
+	fprintf(m_file, "%u,%u,%u,%u,%d,%d,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%d,%u,%d,%08X\n",
+		m_request.frame, (UnsignedInt)m_request.objectID, m_requestKinds, m_request.surfaces,
+		m_request.diameter, m_request.crusher ? 1 : 0,
+		m_request.from.x, m_request.from.y, m_request.from.z, m_request.fromLayer,
+		m_request.to.x, m_request.to.y, m_request.to.z,
+		cellsExamined, time, nodeCount, pathHash);
+}
+
+void PathfindRequestProfile::printSummary() const
+{
+	if (m_latencies.empty())
+	{
+		printf("Pathfind requests: 0\n");
+		return;
+	}
+
+	std::vector<UnsignedInt> sorted = m_latencies;
+	std::sort(sorted.begin(), sorted.end());
+	const size_t count = sorted.size();
+
+	printf("Pathfind requests: %u Cells: %u Time us p50: %u p90: %u p99: %u max: %u Path hash: %08X\n",
+		(UnsignedInt)count, m_totalCells,
+		sorted[count * 50 / 100], sorted[count * 90 / 100], sorted[count * 99 / 100], sorted[count - 1],
+		m_combinedHash);
+}
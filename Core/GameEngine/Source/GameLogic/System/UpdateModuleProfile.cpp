@@ -0,0 +1,232 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "GameLogic/UpdateModuleProfile.h"
+
+#include "Common/ThingTemplate.h"
+#include "GameClient/DebugDisplay.h"
+#include "GameLogic/Module/UpdateModule.h"
+
+
+UpdateModuleProfile* TheUpdateModuleProfile = nullptr;
+
+//-------------------------------------------------------------------------------------------------
+UpdateModuleProfile::Stats::Stats() :
+	m_calls(0),
+	m_totalTicks(0),
+	m_maxTicks(0),
+	m_sleepFrames(0),
+	m_sleepForeverCalls(0)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfile::Stats::add(Int64 ticks, UnsignedInt sleepFrames)
+{
+	++m_calls;
+	m_totalTicks += ticks;
+	if (ticks > m_maxTicks)
+		m_maxTicks = ticks;
+	if (sleepFrames >= UPDATE_SLEEP_FOREVER)
+		++m_sleepForeverCalls;
+	else
+		m_sleepFrames += sleepFrames;
+}
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt UpdateModuleProfile::Stats::getAverageSleepFrames() const
+{
+	const UnsignedInt sleepCalls = m_calls - m_sleepForeverCalls;
+	return sleepCalls > 0 ? (UnsignedInt)(m_sleepFrames / sleepCalls) : 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+UpdateModuleProfile::UpdateModuleProfile()
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	m_freq = freq.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfile::reset()
+{
+	m_modules.clear();
+	m_templates.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 UpdateModuleProfile::getTicks() const
+{
+	LARGE_INTEGER tick;
+	QueryPerformanceCounter(&tick);
+	return tick.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt64 UpdateModuleProfile::toTime(Int64 ticks, Int64 unitsPerSecond) const
+{
+	// Whole seconds first, so that long replays do not overflow the multiplication.
+	const Int64 seconds = ticks / m_freq;
+	const Int64 remainder = ticks % m_freq;
+	return static_cast<UnsignedInt64>(seconds * unitsPerSecond + remainder * unitsPerSecond / m_freq);
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfile::addCall(NameKeyType moduleNameKey, const ThingTemplate* thingTemplate, Int64 ticks, UnsignedInt sleepFrames)
+{
+	m_modules[moduleNameKey].add(ticks, sleepFrames);
+
+	if (thingTemplate != nullptr)
+	{
+		TemplateStats& stats = m_templates[thingTemplate->getTemplateID()];
+		if (stats.m_name.isEmpty())
+			stats.m_name = thingTemplate->getName();
+		stats.m_stats.add(ticks, sleepFrames);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool UpdateModuleProfile::isHigherTotal(const Entry& a, const Entry& b)
+{
+	return a.m_stats->m_totalTicks > b.m_stats->m_totalTicks;
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfile::getModuleEntries(std::vector<Entry>& entries) const
+{
+	entries.clear();
+	entries.reserve(m_modules.size());
+	for (ModuleStatsMap::const_iterator it = m_modules.begin(); it != m_modules.end(); ++it)
+	{
+		Entry entry;
+		entry.m_name = TheNameKeyGenerator->keyToName(it->first);
+		entry.m_stats = &it->second;
+		entries.push_back(entry);
+	}
+	std::sort(entries.begin(), entries.end(), isHigherTotal);
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfile::getTemplateEntries(std::vector<Entry>& entries) const
+{
+	entries.clear();
+	entries.reserve(m_templates.size());
+	for (TemplateStatsMap::const_iterator it = m_templates.begin(); it != m_templates.end(); ++it)
+	{
+		Entry entry;
+		entry.m_name = it->second.m_name;
+		entry.m_stats = &it->second.m_stats;
+		entries.push_back(entry);
+	}
+	std::sort(entries.begin(), entries.end(), isHigherTotal);
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool UpdateModuleProfile::writeCSV(const char* filename) const
+{
+	FILE* file = fopen(filename, "wt");
+	if (file == nullptr)
+		return FALSE;
+
+	// Integer math, so that the profile does not touch the floating point state of the logic.
+	fprintf(file, "kind,name,calls,total_us,max_us,avg_ns,avg_sleep_frames,sleep_forever_calls\n");
+
+	std::vector<Entry> entries;
+	for (Int kind = 0; kind < 2; ++kind)
+	{
+		if (kind == 0)
+			getModuleEntries(entries);
+		else
+			getTemplateEntries(entries);
+
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			const Stats& stats = *entries[i].m_stats;
+			fprintf(file, "%s,%s,%u,%I64u,%I64u,%I64u,%u,%u\n",
+				kind == 0 ? "module" : "template",
+				entries[i].m_name.str(),
+				stats.m_calls,
+				toMicroseconds(stats.m_totalTicks),
+				toMicroseconds(stats.m_maxTicks),
+				toNanoseconds(stats.m_totalTicks / stats.m_calls),
+				stats.getAverageSleepFrames(),
+				stats.m_sleepForeverCalls);
+		}
+	}
+
+	fclose(file);
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfile::printSummary(Int count) const
+{
+	std::vector<Entry> entries;
+	getModuleEntries(entries);
+
+	printf("Update modules: %u classes, %u templates\n", (UnsignedInt)m_modules.size(), (UnsignedInt)m_templates.size());
+	for (Int i = 0; i < count && i < (Int)entries.size(); ++i)
+	{
+		const Stats& stats = *entries[i].m_stats;
+		printf("  %-32s calls: %u Time us total: %I64u max: %I64u\n",
+			entries[i].m_name.str(), stats.m_calls, toMicroseconds(stats.m_totalTicks), toMicroseconds(stats.m_maxTicks));
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfile::debugDisplay(DebugDisplayInterface* dd, Int count) const
+{
+	std::vector<Entry> entries;
+	for (Int kind = 0; kind < 2; ++kind)
+	{
+		if (kind == 0)
+		{
+			getModuleEntries(entries);
+			dd->printf("Update module classes: %d\n", (Int)entries.size());
+		}
+		else
+		{
+			getTemplateEntries(entries);
+			dd->printf("\nThing templates: %d\n", (Int)entries.size());
+		}
+
+		for (Int i = 0; i < count && i < (Int)entries.size(); ++i)
+		{
+			const Stats& stats = *entries[i].m_stats;
+			dd->printf("  %s: %u calls, %I64u us total, %I64u us max, %u frames avg sleep\n",
+				entries[i].m_name.str(),
+				stats.m_calls,
+				toMicroseconds(stats.m_totalTicks),
+				toMicroseconds(stats.m_maxTicks),
+				stats.getAverageSleepFrames());
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateModuleProfileDebugDisplay(DebugDisplayInterface* dd, void*, FILE* fp)
+{
+	if (!dd || !TheUpdateModuleProfile)
+		return;
+
+	dd->setCursorPos(0, 0);
+	dd->setRightMargin(2);
+	TheUpdateModuleProfile->debugDisplay(dd, 15);
+}
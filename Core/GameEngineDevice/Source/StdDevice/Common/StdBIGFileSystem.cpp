@@ -78,6 +78,34 @@ void StdBIGFileSystem::update() {
 void StdBIGFileSystem::postProcessLoad() {
 }
 
+// Reads the directory listing of a BIG file and checks that it holds all its entries.
+static Bool readDirectory(File *fp, Int start, Int size, Int numFiles, std::vector<char>& directory)
+{
+	if (size < 0 || numFiles < 0) {
+		return FALSE;
+	}
+
+	directory.resize(size);
+	if (fp->seek(start, File::START) != start || fp->read(directory.data(), size) != size) {
+		return FALSE;
+	}
+
+	Int pos = 0;
+	for (Int i = 0; i < numFiles; ++i) {
+		pos += 8;
+		if (pos >= size) {
+			return FALSE;
+		}
+		const char *end = (const char *)memchr(directory.data() + pos, 0, size - pos);
+		if (end == nullptr) {
+			return FALSE;
+		}
+		pos = (Int)(end - directory.data()) + 1;
+	}
+
+	return TRUE;
+}
+
 ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 	File *fp = TheLocalFileSystem->openFile(filename, File::READ | File::BINARY);
 	AsciiString archiveFileName;
@@ -125,16 +153,37 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 //		buffer[(4-i)-1] = t;
 //	}
 
-	// seek to the beginning of the directory listing.
-	fp->seek(0x10, File::START);
+	// read in the size of the header, which is where the first file starts.
+	Int headerSize = 0;
+	fp->read(&headerSize, 4);
+	headerSize = betoh(headerSize);
+
+	// TheSuperHackers @performance 18/10/2026 Read the whole directory listing with one read instead of reading each
+	// file name one byte at a time. Should the header size be wrong, read as much as the listing can possibly take.
+	const Int directoryStart = 0x10;
+	const Int archiveSize = fp->size();
+	std::vector<char> directory;
+	if (!readDirectory(fp, directoryStart, min(headerSize, archiveSize) - directoryStart, numLittleFiles, directory)) {
+		const Int maxDirectorySize = (Int)min((Int64)archiveSize - directoryStart, (Int64)numLittleFiles * (8 + _MAX_PATH));
+		if (!readDirectory(fp, directoryStart, maxDirectorySize, numLittleFiles, directory)) {
+			DEBUG_CRASH(("Error reading the directory listing in file %s", filename));
+			delete archiveFile;
+			fp->close();
+			fp = nullptr;
+			return nullptr;
+		}
+	}
+
 	// read in each directory listing.
 	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
+	char *entry = directory.data();
 
 	for (Int i = 0; i < numLittleFiles; ++i) {
 		Int filesize = 0;
 		Int fileOffset = 0;
-		fp->read(&fileOffset, 4);
-		fp->read(&filesize, 4);
+		memcpy(&fileOffset, entry, 4);
+		memcpy(&filesize, entry + 4, 4);
+		entry += 8;
 
 		filesize = betoh(filesize);
 		fileOffset = betoh(fileOffset);
@@ -143,29 +192,24 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 		fileInfo->m_offset = fileOffset;
 		fileInfo->m_size = filesize;
 
-		// read in the path name of the file.
-		Int pathIndex = -1;
-		do {
-			++pathIndex;
-			fp->read(buffer + pathIndex, 1);
-		} while (buffer[pathIndex] != 0);
+		// the path name of the file.
+		char *pathName = entry;
+		const Int pathIndex = (Int)strlen(pathName);
+		entry += pathIndex + 1;
 
 		Int filenameIndex = pathIndex;
-		while ((filenameIndex >= 0) && (buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/')) {
+		while ((filenameIndex >= 0) && (pathName[filenameIndex] != '\\') && (pathName[filenameIndex] != '/')) {
 			--filenameIndex;
 		}
 
-		fileInfo->m_filename = (char *)(buffer + filenameIndex + 1);
+		fileInfo->m_filename = (char *)(pathName + filenameIndex + 1);
 		fileInfo->m_filename.toLower();
-		buffer[filenameIndex + 1] = 0;
+		pathName[filenameIndex + 1] = 0;
 
 		AsciiString path;
-		path = buffer;
+		path = pathName;
 
-		AsciiString debugpath;
-		debugpath = path;
-		debugpath.concat(fileInfo->m_filename);
-//		DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - adding file %s to archive file %s, file number %d", debugpath.str(), fileInfo->m_archiveFilename.str(), i));
+//		DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - adding file %s%s to archive file %s, file number %d", path.str(), fileInfo->m_filename.str(), fileInfo->m_archiveFilename.str(), i));
 
 		archiveFile->addFile(path, fileInfo);
 	}
@@ -197,6 +241,7 @@ void StdBIGFileSystem::closeArchiveFile(const Char *filename) {
 
 	// may need to do some other processing here first.
 
+	removeFromFileIndex(it->second);
 	delete (it->second);
 	m_archiveFileMap.erase(it);
 }
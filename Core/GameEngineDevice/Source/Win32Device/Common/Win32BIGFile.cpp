@@ -28,6 +28,7 @@
 
 #include "Common/LocalFile.h"
 #include "Common/LocalFileSystem.h"
+#include "Common/MappedArchiveFile.h"
 #include "Common/RAMFile.h"
 #include "Common/StreamingArchiveFile.h"
 #include "Common/GameMemory.h"
@@ -67,14 +68,26 @@ File* Win32BIGFile::openFile( const Char *filename, Int access )
 	}
 
 	RAMFile *ramFile = nullptr;
+	Bool opened = FALSE;
 
-	if (BitIsSet(access, File::STREAMING))
+	if (BitIsSet(access, File::STREAMING)) {
 		ramFile = newInstance( StreamingArchiveFile );
-	else
+		ramFile->deleteOnClose();
+		opened = ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size);
+	} else if ((access & File::WRITE) == 0) {
+		// TheSuperHackers @performance 18/10/2026 Read only files are read from a mapping of the archive.
+		// The archive was opened by TheLocalFileSystem, so it is a LocalFile.
+		MappedArchiveFile *mappedFile = newInstance( MappedArchiveFile );
+		mappedFile->deleteOnClose();
+		opened = mappedFile->openFromLocalArchive(static_cast<LocalFile*>(m_file), fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size);
+		ramFile = mappedFile;
+	} else {
 		ramFile = newInstance( RAMFile );
+		ramFile->deleteOnClose();
+		opened = ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size);
+	}
 
-	ramFile->deleteOnClose();
-	if (ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
+	if (opened == FALSE) {
 		ramFile->close();
 		ramFile = nullptr;
 		return nullptr;
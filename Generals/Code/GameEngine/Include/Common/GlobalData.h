@@ -52,6 +52,7 @@ enum AIDebugOptions CPP_11(: Int);
 
 constexpr const Int MAX_GLOBAL_LIGHTS = 3;
 constexpr const Int SIMULATE_REPLAYS_SEQUENTIAL = -1;
+constexpr const Int SIMULATE_REPLAYS_MAX_PER_JOB = 30; ///< Limited by the bits of the worker process exit code
 
 //-------------------------------------------------------------------------------------------------
 class CommandLineData
@@ -353,6 +354,17 @@ public:
 
 	std::vector<AsciiString> m_simulateReplays; ///< If not empty, simulate this list of replays and exit.
 	Int m_simulateReplayJobs; ///< Maximum number of processes to use for simulation, or SIMULATE_REPLAYS_SEQUENTIAL for sequential simulation
+	Int m_simulateReplaysPerJob; ///< Number of replays each worker process simulates in sequence
+	Bool m_simulateReplayBatchWorker; ///< This process is a worker that simulates several replays and returns the failed ones as bit mask
+	Bool m_simulateReplayProfile; ///< Write a per-frame logic stage timing profile for each simulated replay
+	Bool m_simulateReplayPathfindProfile; ///< Write a per-request pathfind timing profile for each simulated replay
+	Bool m_simulateReplayUpdateProfile; ///< Write the update module timing per module class and template for each simulated replay
+	Bool m_simulateReplayMemoryPools; ///< Write the memory pool usage of each simulated replay and a tuned pool size table
+	Bool m_simulateReplayFrameCRC; ///< Write the incremental logic CRC of each frame of each simulated replay
+	Bool m_simulateReplayParticles; ///< Simulate the particle systems in Headless Mode and time their update for each simulated replay
+	UnsignedInt m_replaySnapshotInterval; ///< Number of frames between replay playback snapshots, or 0 to disable
+	UnsignedInt m_replayResumeFrame; ///< Resume replay simulation from the latest snapshot at or before this frame, or 0 to disable
+	Bool m_useINICache; ///< Load the INI files from the INI cache in the user data folder when it is up to date
 
 	Int m_maxParticleCount;						///< maximum number of particles that can exist
 	Int m_maxFieldParticleCount;			///< maximum number of field-type particles that can exist (roughly)
@@ -89,6 +89,7 @@ enum
 	AI_VISIONFACTOR_GUARDINNER = 0x04,
 };
 enum {MAX_AI_UPGRADES = 20};
+enum {DEFAULT_PATHFIND_CELLS_PER_FRAME = 5000};
 
 typedef struct {
 	Int	m_numSkills;
@@ -216,6 +217,10 @@ public:
 	Int	 m_infantryPathfindDiameter; // Diameter of path in cells for infantry.
 	Int  m_vehiclePathfindDiameter;  // Diameter of path in cells for vehicles.
 
+	// TheSuperHackers @performance 18/10/2026 Per frame budget of the pathfind queue.
+	Int  m_pathfindCellsPerFrame;  // Number of pathfind cells the pathfind queue may examine per logic frame.
+	Bool m_pathfindCarryOverCells; // If true, cells examined beyond the budget are taken from the budget of the next frames.
+
 	Int  m_rebuildDelaySeconds;  // Seconds to delay rebuilding after a base building is destroyed or captured.
 
 	Real  m_supplyCenterSafeRadius;  // Radius to scan for enemies to determine safety.
@@ -174,6 +174,14 @@ public:
 
 	// ids and binding
 	ObjectID getID() const { return m_id; }												///< this object's unique ID
+
+	// TheSuperHackers @performance 18/10/2026 Cached CRC of this object for GameLogic::getIncrementalCRC.
+	// Everything that changes the data of Object::crc must call markCRCDirty.
+	void markCRCDirty() const { m_crcDirty = TRUE; }
+	Bool isCRCDirty() const { return m_crcDirty; }
+	UnsignedInt getCachedCRC() const { return m_cachedCRC; }
+	void setCachedCRC( UnsignedInt crc ) { m_cachedCRC = crc; m_crcDirty = FALSE; }
+
 	void friend_bindToDrawable( Drawable *draw );									///< set drawable association. for use ONLY by GameLogic!
 	Drawable* getDrawable() const { return m_drawable; }					///< drawable (if any) bound to obj
 
@@ -532,8 +540,8 @@ public:
 	Bool hasSpecialPower( SpecialPowerType type ) const;
 	Bool hasAnySpecialPower() const;
 
-	void setWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition |= (1 << wst); }
-	void clearWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition &= ~(1 << wst); }
+	void setWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition |= (1 << wst); markCRCDirty(); }
+	void clearWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition &= ~(1 << wst); markCRCDirty(); }
   // note, the !=0 at the end is important, to convert this into a boolean type! (srj)
 	Bool testWeaponBonusCondition(WeaponBonusConditionType wst) const { return (m_weaponBonusCondition & (1 << wst)) != 0; }
 	inline WeaponBonusConditionFlags getWeaponBonusCondition() const { return m_weaponBonusCondition; }
@@ -776,6 +784,8 @@ private:
 #endif
 	UnsignedByte									m_scriptStatus;					///< status as set by scripting, corresponds to ORed ObjectScriptStatusBits
 	UnsignedByte									m_privateStatus;					///< status bits that are never directly accessible to outside world
+	mutable Bool									m_crcDirty;								///< m_cachedCRC is out of date
+	UnsignedInt										m_cachedCRC;							///< CRC of this object when it was last clean
 	Byte													m_numTriggerAreasActive;
 	Bool													m_singleUseCommandUsed;
 	Bool													m_isReceivingDifficultyBonus;
@@ -47,7 +47,7 @@ Int GameMain()
 
 	if (!TheGlobalData->m_simulateReplays.empty())
 	{
-		exitcode = ReplaySimulation::simulateReplays(TheGlobalData->m_simulateReplays, TheGlobalData->m_simulateReplayJobs);
+		exitcode = ReplaySimulation::simulateReplays(TheGlobalData->m_simulateReplays, TheGlobalData->m_simulateReplayJobs, TheGlobalData->m_simulateReplaysPerJob);
 	}
 	else
 	{
@@ -989,6 +989,17 @@ GlobalData::GlobalData()
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplaysPerJob = 1;
+	m_simulateReplayBatchWorker = FALSE;
+	m_simulateReplayProfile = FALSE;
+	m_simulateReplayPathfindProfile = FALSE;
+	m_simulateReplayUpdateProfile = FALSE;
+	m_simulateReplayMemoryPools = FALSE;
+	m_simulateReplayFrameCRC = FALSE;
+	m_simulateReplayParticles = FALSE;
+	m_replaySnapshotInterval = 0;
+	m_replayResumeFrame = 0;
+	m_useINICache = FALSE;
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
@@ -38,6 +38,7 @@
 #include "Common/PlayerTemplate.h"
 #include "Common/ThingTemplate.h"
 #include "Common/WellKnownKeys.h"
+#include "Common/WorkerThreadPool.h"
 #include "Common/Xfer.h"
 #include "GameClient/Drawable.h"
 
@@ -164,6 +165,55 @@ static Bool locoSetMatches(LocomotorSurfaceTypeMask lstm, UnsignedInt surfaceBit
 	return (surfaceBitFlags & lstm) != 0;
 }
 
+// ------------------------------------------------------------------------
+/** The filters of the enemy sighted query of one team member. */
+struct EnemySightedFilters
+{
+	EnemySightedFilters(const Object *obj) :
+		m_filterTeam(obj, PartitionFilterRelationship::ALLOW_ENEMIES),
+		m_filterMapStatus(obj)
+	{
+	}
+
+	// only consider enemies.
+	PartitionFilterRelationship	m_filterTeam;
+	// and only stuff that is not dead
+	PartitionFilterAlive m_filterAlive;
+	PartitionFilterSameMapStatus m_filterMapStatus;
+};
+
+// TheSuperHackers @performance 18/10/2026 The queries of the enemy sighted check, kept per team so
+// that their buffers are reused instead of allocated on every update.
+struct TeamEnemySightedQueries
+{
+	std::vector<EnemySightedFilters> m_memberFilters;
+	std::vector<PartitionQuery> m_queries;
+	std::vector<PartitionFilter *> m_filterLists;
+#ifdef FASTER_GCO
+	std::vector<PartitionManager::QueryCandidateVec> m_candidates;
+#endif
+};
+
+#ifdef FASTER_GCO
+// ------------------------------------------------------------------------
+/** Gathers the partition cells of the enemy sighted queries on the worker threads. */
+class EnemySightedGatherJob : public WorkerThreadJob
+{
+public:
+	EnemySightedGatherJob(const PartitionQuery *queries, PartitionManager::QueryCandidateVec *candidates) :
+		m_queries(queries), m_candidates(candidates) {}
+
+	virtual void runJob(Int index) override
+	{
+		ThePartitionManager->friend_gatherQueryCandidates(m_queries[index], m_candidates[index]);
+	}
+
+private:
+	const PartitionQuery *m_queries;
+	PartitionManager::QueryCandidateVec *m_candidates;
+};
+#endif
+
 // ------------------------------------------------------------------------
 
 // ------------------------------------------------------------------------
@@ -1309,6 +1359,7 @@ Team::Team(TeamPrototype *proto, TeamID id ) :
 	m_active(false),
 	m_seeEnemy(false),
 	m_prevSeeEnemy(false),
+	m_enemySightedQueries(nullptr),
 	m_checkEnemySighted(false),
 	m_isRecruitablitySet(false),
 	m_isRecruitable(false),
@@ -1379,6 +1430,8 @@ Team::~Team()
 	// make sure the xfer list is clear
 	m_xferMemberIDList.clear();
 
+	delete m_enemySightedQueries;
+
 }
 
 // ------------------------------------------------------------------------
@@ -1830,26 +1883,74 @@ void Team::updateState()
 		m_seeEnemy = false;
 		Bool anyAliveInTeam = false; // If we're all dead, don't do all clear.
 		// only consider enemies.
+		// TheSuperHackers @performance 18/10/2026 The members look for enemies in one query batch,
+		// so that the partition cells of all members are searched on the worker threads. Like before,
+		// the search stops at the first member that sees an enemy.
+		if (m_enemySightedQueries == nullptr)
+			m_enemySightedQueries = NEW TeamEnemySightedQueries;
+		std::vector<EnemySightedFilters>& memberFilters = m_enemySightedQueries->m_memberFilters;
+		std::vector<PartitionQuery>& queries = m_enemySightedQueries->m_queries;
+		std::vector<PartitionFilter *>& filterLists = m_enemySightedQueries->m_filterLists;
+		memberFilters.clear();
+		queries.clear();
 		for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
 		{
 			if (iter.cur()->isEffectivelyDead())
 				continue;
 
-			PartitionFilterRelationship	filterTeam(iter.cur(), PartitionFilterRelationship::ALLOW_ENEMIES);
+			anyAliveInTeam = true;
+			memberFilters.push_back(EnemySightedFilters(iter.cur()));
 
-			// and only stuff that is not dead
-			PartitionFilterAlive filterAlive;
-			PartitionFilterSameMapStatus filterMapStatus(iter.cur());
+			PartitionQuery query;
+			query.obj = iter.cur();
+			query.maxDist = iter.cur()->getVisionRange();
+			query.dc = FROM_CENTER_2D;
+			queries.push_back(query);
+		}
+		if (!queries.empty())
+		{
+			// The filter lists point into memberFilters, which does not grow anymore.
+			const size_t numQueries = queries.size();
+			filterLists.resize(numQueries * 4);
+			for (size_t i = 0; i < numQueries; ++i)
+			{
+				PartitionFilter **filters = &filterLists[i * 4];
+				filters[0] = &memberFilters[i].m_filterTeam;
+				filters[1] = &memberFilters[i].m_filterAlive;
+				filters[2] = &memberFilters[i].m_filterMapStatus;
+				filters[3] = nullptr;
+				queries[i].filters = filters;
+			}
 
-			PartitionFilter *filters[] = { &filterTeam, &filterAlive, &filterMapStatus, nullptr };
-			Real visionRange = iter.cur()->getVisionRange();
-			anyAliveInTeam = true;
-			Object *pObj = ThePartitionManager->getClosestObject( iter.cur(), visionRange,
-				FROM_CENTER_2D, filters );
-			if (pObj) {
-				m_seeEnemy = true;
-				break;
+#ifdef FASTER_GCO
+			// Gather one member per thread at a time, so that the members after the first one that sees
+			// an enemy are not searched. The filters run on this thread in member order.
+			std::vector<PartitionManager::QueryCandidateVec>& candidates = m_enemySightedQueries->m_candidates;
+			if (candidates.size() < numQueries)
+				candidates.resize(numQueries);
+			const size_t chunkSize = TheWorkerThreadPool ? TheWorkerThreadPool->getNumThreads() + 1 : 1;
+			for (size_t first = 0; first < numQueries && !m_seeEnemy; first += chunkSize)
+			{
+				const size_t count = (numQueries - first < chunkSize) ? numQueries - first : chunkSize;
+				EnemySightedGatherJob job(&queries[first], &candidates[first]);
+				if (count > 1)
+					TheWorkerThreadPool->run(&job, (Int)count);
+				else
+					job.runJob(0);
+
+				for (size_t i = first; i < first + count && !m_seeEnemy; ++i)
+				{
+					ThePartitionManager->friend_mergeQueryCandidates(queries[i], candidates[i]);
+					m_seeEnemy = queries[i].closestObj != nullptr;
+				}
+			}
+#else
+			for (size_t i = 0; i < numQueries && !m_seeEnemy; ++i)
+			{
+				m_seeEnemy = ThePartitionManager->getClosestObject(queries[i].obj, queries[i].maxDist,
+					queries[i].dc, queries[i].filters) != nullptr;
 			}
+#endif
 		}
 		if (anyAliveInTeam) {
 			if (m_prevSeeEnemy != m_seeEnemy)
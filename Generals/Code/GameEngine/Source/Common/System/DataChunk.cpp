@@ -37,13 +37,23 @@
 // If verbose, lots of debug logging.
 #define not_VERBOSE
 
-CachedFileInputStream::CachedFileInputStream():m_buffer(nullptr),m_size(0)
+CachedFileInputStream::CachedFileInputStream():m_buffer(nullptr),m_file(nullptr),m_size(0)
 {
 }
 
 CachedFileInputStream::~CachedFileInputStream()
 {
-	delete[] m_buffer;
+	releaseBuffer();
+}
+
+void CachedFileInputStream::releaseBuffer()
+{
+	if (m_file) {
+		m_file->close();
+		m_file=nullptr;
+	} else {
+		delete[] m_buffer;
+	}
 	m_buffer=nullptr;
 }
 
@@ -55,7 +65,13 @@ Bool CachedFileInputStream::open(AsciiString path)
 	if (file) {
 		m_size=file->size();
 		if (m_size) {
-			m_buffer = file->readEntireAndClose();
+			// TheSuperHackers @performance 18/10/2026 Read straight from the file if it already holds its contents in memory.
+			m_buffer = file->getEntireContents();
+			if (m_buffer) {
+				m_file = file;
+			} else {
+				m_buffer = file->readEntireAndClose();
+			}
 			file = nullptr;
 		}
 		m_pos=0;
@@ -71,11 +87,12 @@ Bool CachedFileInputStream::open(AsciiString path)
 		//DEBUG_LOG(("CachedFileInputStream::open() - file %s is compressed!  It should go from %d to %d", path.str(),
 		//	m_size, uncompLen));
 		char *uncompBuffer = NEW char[uncompLen];
-		Int actualLen = CompressionManager::decompressData(m_buffer, m_size, uncompBuffer, uncompLen);
+		// decompressData only reads the source, which may be mapped read only.
+		Int actualLen = CompressionManager::decompressData(const_cast<char*>(m_buffer), m_size, uncompBuffer, uncompLen);
 		if (actualLen == uncompLen)
 		{
 			//DEBUG_LOG(("Using uncompressed data"));
-			delete[] m_buffer;
+			releaseBuffer();
 			m_buffer = uncompBuffer;
 			m_size = uncompLen;
 		}
@@ -101,8 +118,7 @@ Bool CachedFileInputStream::open(AsciiString path)
 
 void CachedFileInputStream::close()
 {
-	delete[] m_buffer;
-	m_buffer=nullptr;
+	releaseBuffer();
 
 	m_pos=0;
 	m_size=0;
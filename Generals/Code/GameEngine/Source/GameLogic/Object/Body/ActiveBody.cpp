@@ -962,6 +962,7 @@ void ActiveBody::updateBodyParticleSystems()
 //-------------------------------------------------------------------------------------------------
 void ActiveBody::internalChangeHealth( Real delta )
 {
+	getObject()->markCRCDirty();
 	// save the current health as the previous health
 	m_prevHealth = m_currentHealth;
 
@@ -197,6 +197,8 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_partitionLastValue(nullptr),
 	m_smcUntil(NEVER),
 	m_privateStatus(0),
+	m_crcDirty(TRUE),
+	m_cachedCRC(0),
 	m_formationID(NO_FORMATION_ID),
 	m_isReceivingDifficultyBonus(FALSE)
 {
@@ -445,6 +447,7 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 //-------------------------------------------------------------------------------------------------
 void Object::initObject()
 {
+	markCRCDirty();
 	// Weapons & Damage -------------------------------------------------------------------------------------------------
 	// Force the initial weapon set to be instantiated & reloaded.
 	m_curWeaponSetFlags.clear();
@@ -784,6 +787,7 @@ void Object::setGeometryInfoZ( Real newZ )
 //=============================================================================
 void Object::friend_setUndetectedDefector( Bool status )
 {
+	markCRCDirty();
 	if (status)
 		m_privateStatus |= UNDETECTED_DEFECTOR;
 	else
@@ -1138,6 +1142,7 @@ void Object::topple( const Coord3D *toppleDirection, Real toppleSpeed, UnsignedI
 //=============================================================================
 void Object::reloadAllAmmo(Bool now)
 {
+	markCRCDirty();
 	m_weaponSet.reloadAllAmmo(this, now);
 }
 
@@ -1384,6 +1389,7 @@ Bool Object::chooseBestWeaponForTarget(const Object* target, WeaponChoiceCriteri
 //=============================================================================
 void Object::fireCurrentWeapon(Object *target)
 {
+	markCRCDirty();
 	//USE_PERF_TIMER(fireCurrentWeapon)
 
 	// victim may have already been destroyed
@@ -1407,6 +1413,7 @@ void Object::fireCurrentWeapon(Object *target)
 //=============================================================================
 void Object::fireCurrentWeapon(const Coord3D* pos)
 {
+	markCRCDirty();
 	//USE_PERF_TIMER(fireCurrentWeapon)
 
 	if (pos == nullptr)
@@ -1429,6 +1436,7 @@ void Object::fireCurrentWeapon(const Coord3D* pos)
 //=============================================================================
 void Object::preFireCurrentWeapon( const Object *victim )
 {
+	markCRCDirty();
 	Weapon* weapon = m_weaponSet.getCurWeapon();
 
 	//If we are going to be capable of firing our weapon NEXT frame, set the pre-attack
@@ -1698,6 +1706,7 @@ void Object::reactToTurretChange( WhichTurretType turret, Real oldRotation, Real
 //DECLARE_PERF_TIMER(Object_reactToTransformChange)
 void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle)
 {
+	markCRCDirty();
 	//USE_PERF_TIMER(Object_reactToTransformChange)
 	if(_isnan(getPosition()->x) || _isnan(getPosition()->y) || _isnan(getPosition()->z)) {
 		DEBUG_CRASH(("Object pos is nan."));
@@ -1874,6 +1883,7 @@ void Object::healCompletely()
 //-------------------------------------------------------------------------------------------------
 void Object::setEffectivelyDead(Bool dead)
 {
+	markCRCDirty();
 	if (dead)
 		BitSet(m_privateStatus, EFFECTIVELY_DEAD);
 	else
@@ -1889,6 +1899,7 @@ void Object::setEffectivelyDead(Bool dead)
 //-------------------------------------------------------------------------------------------------
 void Object::setCaptured(Bool isCaptured)
 {
+	markCRCDirty();
 	if (isCaptured)
 		BitSet(m_privateStatus, CAPTURED);
 	else
@@ -2619,6 +2630,7 @@ void Object::friend_prepareForMapBoundaryAdjust()
 //-------------------------------------------------------------------------------------------------
 void Object::friend_notifyOfNewMapBoundary()
 {
+	markCRCDirty();
 	ThePartitionManager->registerObject(this);
 	TheRadar->addObject(this);
 	TheAI->pathfinder()->addObjectToPathfindMap( this );
@@ -2835,6 +2847,7 @@ Bool Object::isMassSelectable() const
 //-------------------------------------------------------------------------------------------------
 void Object::setWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -2846,6 +2859,7 @@ void Object::setWeaponSetFlag(WeaponSetType wst)
 //-------------------------------------------------------------------------------------------------
 void Object::clearWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst, 0);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -4088,6 +4102,7 @@ Bool Object::affectedByUpgrade( const UpgradeTemplate *upgradeT ) const
 //-------------------------------------------------------------------------------------------------
 void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 {
+	markCRCDirty();
 	if (upgradeT)
 	{
 		m_objectUpgradesCompleted.set( upgradeT->getUpgradeMask() );
@@ -4105,6 +4120,7 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 //-------------------------------------------------------------------------------------------------
 void Object::removeUpgrade( const UpgradeTemplate *upgradeT )
 {
+	markCRCDirty();
 	m_objectUpgradesCompleted.clear( upgradeT->getUpgradeMask() );
 	for (BehaviorModule** module = m_behaviors; *module; ++module)
 	{
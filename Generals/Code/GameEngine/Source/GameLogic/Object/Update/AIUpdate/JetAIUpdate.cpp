@@ -1449,6 +1449,7 @@ public:
 			if (w == nullptr)
 				continue;
 
+			jet->markCRCDirty();
 			if (now >= m_reloadDoneFrame)
 				w->setClipPercentFull(1.0f, false);
 			else
@@ -4677,7 +4677,7 @@ void ScriptEngine::reset()
 	m_namedReveals.clear();
 
 	// Clear the named objects list.
- 	m_namedObjects.clear();
+ 	clearNamedObjects();
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
@@ -5298,10 +5298,9 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 		return m_conditionObject;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return it->second;
-		}
+	const Int index = findNamedObjectByName(unitName);
+	if (index >= 0) {
+		return m_namedObjects[index].second;
 	}
 	return nullptr;
 }
@@ -5311,10 +5310,9 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::didUnitExist(const AsciiString& unitName)
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return (it->second == nullptr);
-		}
+	const Int index = findNamedObjectByName(unitName);
+	if (index >= 0) {
+		return (m_namedObjects[index].second == nullptr);
 	}
 	return false;
 }
@@ -6258,6 +6256,10 @@ void ScriptEngine::executeScript( Script *pScript )
 		case DIFFICULTY_NORMAL : if (!pScript->isNormal()) return;  break;
 		case DIFFICULTY_HARD : if (!pScript->isHard()) return;  break;
 	}
+	// TheSuperHackers @info 18/10/2026 Conditions are polled on purpose. Skipping evaluations until a
+	// dependency changes would also skip the false actions of team scripts, and most conditions read
+	// state without a change signal, such as timers, object health, positions and the frame number.
+	// A per frame cap would delay scripts. Either changes the mission logic and breaks replays.
 	// If we are doing periodic evaluation, check the frame.
 	if (TheGameLogic->getFrame()<pScript->getFrameToEvaluate()) {
 		return;
@@ -6394,35 +6396,34 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		return;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (it->first == objName) {
-			if (it->second == nullptr) {
-				AsciiString newNameForDead;
-				newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
-				AppendDebugMessage(newNameForDead, FALSE);
-				DEBUG_LOG((newNameForDead.str()));
-				it->second = pNewObject;
-				return;
-			} else {
-				DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s',"
-										 " but object (%d) of type '%s' already has that name",
-										 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(),
-										 it->second->getID(), it->second->getTemplate()->getName().str()));
-				return;
-			}
-		}
+	// The first entry with either the name or the object wins, as it did when this searched the vector.
+	const Int nameIndex = findNamedObjectByName(objName);
+	const Int objectIndex = findNamedObjectByObject(pNewObject);
 
-		if (pNewObject == (it->second)) {
-			it->first = objName;
+	if (nameIndex >= 0 && (objectIndex < 0 || nameIndex <= objectIndex)) {
+		Object *namedObject = m_namedObjects[nameIndex].second;
+		if (namedObject == nullptr) {
+			AsciiString newNameForDead;
+			newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
+			AppendDebugMessage(newNameForDead, FALSE);
+			DEBUG_LOG((newNameForDead.str()));
+			setNamedObject(nameIndex, pNewObject);
+			return;
+		} else {
+			DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s',"
+									 " but object (%d) of type '%s' already has that name",
+									 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(),
+									 namedObject->getID(), namedObject->getTemplate()->getName().str()));
 			return;
 		}
 	}
 
-	NamedRequest req;
-	req.first = objName;
-	req.second = pNewObject;
+	if (objectIndex >= 0) {
+		setNamedObjectName(objectIndex, objName);
+		return;
+	}
 
-	m_namedObjects.push_back(req);
+	addNamedObject(objName, pNewObject);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6430,11 +6431,9 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::removeObjectFromCache( Object* pDeadObject )
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (pDeadObject == (it->second)) {
-			it->second = nullptr;	// Don't remove it, cause we want to check whether we ever knew a name later
-			break;
-		}
+	const Int index = findNamedObjectByObject(pDeadObject);
+	if (index >= 0) {
+		setNamedObject(index, nullptr);	// Don't remove it, cause we want to check whether we ever knew a name later
 	}
 }
 
@@ -6463,28 +6462,137 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 
 	pNewObject->setName(unitName); // make sure it has the correct name.
 
-	//Loop through the cached list and find the string entry. If found, change the object
+	//Find the string entry in the cached list. If found, change the object
 	//so it's pointing to the new one.
-	for( VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it )
+	const Int index = findNamedObjectByName( unitName );
+	if( index >= 0 )
+	{
+		Object* pOldObj = m_namedObjects[index].second;
+		if( pOldObj )
+		{
+			// if you are transferring your name, you should also transfer any custom indicator color you have.
+			if (pOldObj->hasCustomIndicatorColor())
+				pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
+			else
+				pNewObject->removeCustomIndicatorColor();
+		}
+
+		setNamedObject( index, pNewObject );
+	}
+
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObjectByName( const AsciiString& name ) const
+{
+	NamedObjectNameIndex::const_iterator it = m_namedObjectNameIndex.find( name );
+	return it != m_namedObjectNameIndex.end() ? it->second : -1;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObjectByObject( const Object *obj ) const
+{
+	if( obj == nullptr )
+		return -1;
+
+	NamedObjectIDIndex::const_iterator it = m_namedObjectIDIndex.find( obj->getID() );
+	if( it == m_namedObjectIDIndex.end() )
+		return -1;
+
+	DEBUG_ASSERTCRASH( m_namedObjects[it->second].second == obj, ("ScriptEngine - named object index is out of date") );
+	return it->second;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::addNamedObject( const AsciiString& name, Object *obj )
+{
+	NamedRequest req;
+	req.first = name;
+	req.second = obj;
+	m_namedObjects.push_back( req );
+
+	const Int index = (Int)m_namedObjects.size() - 1;
+
+	// Keep the first entry when the map has several objects with the same name.
+	m_namedObjectNameIndex.insert( NamedObjectNameIndex::value_type( name, index ) );
+	if( obj )
+		m_namedObjectIDIndex.insert( NamedObjectIDIndex::value_type( obj->getID(), index ) );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::setNamedObjectName( Int index, const AsciiString& name )
+{
+	const AsciiString oldName = m_namedObjects[index].first;
+	m_namedObjects[index].first = name;
+
+	// Let the old name point at its next entry, if there is one.
+	NamedObjectNameIndex::iterator it = m_namedObjectNameIndex.find( oldName );
+	if( it != m_namedObjectNameIndex.end() && it->second == index )
 	{
-		if( !unitName.compare( it->first ) )
+		m_namedObjectNameIndex.erase( it );
+		for( Int i = index + 1; i < (Int)m_namedObjects.size(); ++i )
 		{
-			Object* pOldObj = it->second;
-			if( pOldObj )
+			if( m_namedObjects[i].first == oldName )
 			{
-				// if you are transferring your name, you should also transfer any custom indicator color you have.
-				if (pOldObj->hasCustomIndicatorColor())
-					pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
-				else
-					pNewObject->removeCustomIndicatorColor();
+				m_namedObjectNameIndex[oldName] = i;
+				break;
 			}
+		}
+	}
 
-			it->second = pNewObject;
+	it = m_namedObjectNameIndex.find( name );
+	if( it == m_namedObjectNameIndex.end() )
+		m_namedObjectNameIndex[name] = index;
+	else if( it->second > index )
+		it->second = index;
+}
 
-			return;
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::setNamedObject( Int index, Object *obj )
+{
+	Object *oldObj = m_namedObjects[index].second;
+	m_namedObjects[index].second = obj;
+
+	// Let the old object point at its next entry, if there is one.
+	if( oldObj )
+	{
+		NamedObjectIDIndex::iterator it = m_namedObjectIDIndex.find( oldObj->getID() );
+		if( it != m_namedObjectIDIndex.end() && it->second == index )
+		{
+			m_namedObjectIDIndex.erase( it );
+			for( Int i = index + 1; i < (Int)m_namedObjects.size(); ++i )
+			{
+				if( m_namedObjects[i].second == oldObj )
+				{
+					m_namedObjectIDIndex[oldObj->getID()] = i;
+					break;
+				}
+			}
 		}
 	}
 
+	if( obj )
+	{
+		NamedObjectIDIndex::iterator it = m_namedObjectIDIndex.find( obj->getID() );
+		if( it == m_namedObjectIDIndex.end() )
+			m_namedObjectIDIndex[obj->getID()] = index;
+		else if( it->second > index )
+			it->second = index;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::clearNamedObjects()
+{
+	m_namedObjects.clear();
+	m_namedObjectNameIndex.clear();
+	m_namedObjectIDIndex.clear();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7009,7 +7117,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::createNamedCache()
 {
-	m_namedObjects.clear();
+	clearNamedObjects();
 
 	if( !TheGameLogic )
 	{
@@ -7019,10 +7127,7 @@ void ScriptEngine::createNamedCache()
 
 	while (pObj) {
 		if (!pObj->getName().isEmpty()) {
-			NamedRequest req;
-			req.first = pObj->getName();
-			req.second = pObj;
-			m_namedObjects.push_back(req);
+			addNamedObject(pObj->getName(), pObj);
 		}
 		pObj = pObj->getNextObject();
 	}
@@ -8299,13 +8404,12 @@ void ScriptEngine::xfer( Xfer *xfer )
 	}
 	else
 	{
-		NamedRequest req;
 
 		//
 		// list should be empty, it is legal for it to not be empty at this point
 		// according to John M., so we're clearing it now
 		//
-		m_namedObjects.clear();
+		clearNamedObjects();
 
 		// read each element
 		for( UnsignedShort i = 0; i < namedObjectsCount; ++i )
@@ -8326,9 +8430,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 			}
 
 			// assign
-			req.first = namedObjectName;
-			req.second = obj;
-			m_namedObjects.push_back( req );
+			addNamedObject( namedObjectName, obj );
 
 		}
 
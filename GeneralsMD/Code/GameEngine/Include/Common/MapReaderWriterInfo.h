@@ -56,6 +56,8 @@
 #define K_WORLDDICT_VERSION_1 1
 #define K_MAPPREVIEW_VERSION_1 1
 /** Virtual helper class, so that we can write map data using FILE* or CFile. */
+class File;
+
 class OutputStream {
 public:
 	virtual Int write(const void *pData, Int numBytes) = 0;
@@ -83,8 +85,10 @@ class CachedFileInputStream : public ChunkInputStream
 {
 protected:
 	int m_size;
-	char* m_buffer;
+	const char* m_buffer;
+	File* m_file;	///< file that owns m_buffer, null if m_buffer is ours
 	int m_pos;
+	void releaseBuffer();
 public:
 	CachedFileInputStream();
 	~CachedFileInputStream();
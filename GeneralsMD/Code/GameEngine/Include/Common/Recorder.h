@@ -28,6 +28,7 @@
 #include "GameNetwork/GameInfo.h"
 
 class File;
+class Xfer;
 
 /**
   * The ReplayGameInfo class holds information about the replay game and
@@ -75,6 +76,7 @@ protected:
 		UnsignedInt getLocalPlayer() const { return m_localPlayer; }
 		void setSawCRCMismatch() { m_sawCRCMismatch = TRUE; }
 		Bool sawCRCMismatch() const { return m_sawCRCMismatch; }
+		void xfer(Xfer *xfer);
 
 	protected:
 		Bool m_sawCRCMismatch;
@@ -110,6 +112,11 @@ public:
 #endif
 	Bool isPlaybackInProgress() const;
 
+	// TheSuperHackers @feature 18/10/2026 Replay snapshots allow to resume a playback close to a given frame
+	// instead of simulating the whole replay from the start, for example to examine a late mismatch.
+	Bool playbackFileFromSnapshot(AsciiString filename, UnsignedInt frame); ///< Resumes playback from the latest snapshot at or before frame.
+	void updatePlaybackSnapshot();									///< Writes a snapshot at the start of every snapshot interval frame.
+
 public:
 	void handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool fromPlayback);
 
@@ -173,6 +180,11 @@ protected:
 	void writeArgument(GameMessageArgumentDataType type, const GameMessageArgumentType arg);
 	void readArgument(GameMessageArgumentDataType type, GameMessage *msg);
 
+	Bool openPlaybackFile(AsciiString filename, ReplayHeader& header, Int& difficulty, Int& rankPoints, Int& maxFPS); ///< Reads the header and sets up m_file for playback.
+	static AsciiString getPlaybackSnapshotName(AsciiString replayFilename, UnsignedInt frame); ///< Save file name relative to the save directory.
+	AsciiString findPlaybackSnapshot(AsciiString replayFilename, UnsignedInt frame); ///< Returns the latest snapshot at or before frame.
+	void xferPlaybackState(Xfer *xfer, UnsignedInt &logicCRC);	///< The playback state that is not part of the game state.
+
 	struct CullBadCommandsResult
 	{
 		CullBadCommandsResult() : hasClearGameDataMessage(false) {}
@@ -193,6 +205,7 @@ protected:
 	Bool m_wasDesync;
 
 	Bool m_doingAnalysis;
+	Bool m_isLoadingPlaybackSnapshot;									///< a snapshot of the current playback is being loaded
 	Bool m_archiveReplays;														///< if true, each replay is archived to the replay archive folder after recording
 
 	Int m_originalGameMode; // valid in replays
@@ -102,6 +102,7 @@ class Script;
 class SidesList;
 class TeamFactory;
 class TeamPrototype;
+struct TeamEnemySightedQueries;
 class Team;
 class ThingTemplate;
 class Waypoint;
@@ -204,6 +205,7 @@ private:
 	Bool					m_checkEnemySighted;///< True if we have an on enemy sighted or all clear script.
 	Bool					m_seeEnemy;					///< True if we see an enemy.
 	Bool					m_prevSeeEnemy;			///< Last value.
+	TeamEnemySightedQueries *m_enemySightedQueries;	///< reused by the enemy sighted check, created on first use
 
 	// Idle flag.
 	Bool					m_wasIdle;					///< True if idle last frame.
@@ -168,6 +168,7 @@ public:
 	Bool hasUpdated() const { return m_hasUpdated; } ///< Returns true if the logic frame has advanced in the current client/render update
 	UnsignedInt getFrame();										///< Returns the current simulation frame number
 	UnsignedInt getCRC( Int mode = CRC_CACHED, AsciiString deepCRCFileName = AsciiString::TheEmptyString );		///< Returns the CRC
+	UnsignedInt getIncrementalCRC();	///< Returns a CRC of the logic state made from the cached CRC of the unchanged objects. Not the network CRC
 
 	void setObjectIDCounter( ObjectID nextObjID ) { m_nextObjID = nextObjID; }
 	ObjectID getObjectIDCounter() { return m_nextObjID; }
@@ -339,6 +340,7 @@ private:
 	Int rebalanceChildSleepyUpdate(Int i);
 	void remakeSleepyUpdate();
 	void validateSleepyUpdate() const;
+	void refreshSleepyUpdatePriority(UpdateModulePtr u);
 
 	bool onNewGame(GameMessage *msg);
 	bool onClearGameData(GameMessage *msg, AIGroupPtr &currentlySelectedGroup);
@@ -482,7 +484,13 @@ private:
 	// never modify it directly; please use the proper access methods.
 	// (for an excellent discussion of priority queues, please see:
 	// http://dogma.net/markn/articles/pq_stl/priority.htm)
-	std::vector<UpdateModulePtr> m_sleepyUpdates;
+	struct SleepyUpdateEntry
+	{
+		SleepyUpdateEntry(UpdateModulePtr u) : m_priority(u->friend_getPriority()), m_module(u) {}
+		UnsignedInt m_priority;		///< copy of m_module->friend_getPriority(), kept up to date by refreshSleepyUpdatePriority
+		UpdateModulePtr m_module;
+	};
+	std::vector<SleepyUpdateEntry> m_sleepyUpdates;
 
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	// this is a plain old list, not a pq.
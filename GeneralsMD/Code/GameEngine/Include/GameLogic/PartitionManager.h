@@ -252,6 +252,7 @@ public:
 	Coord3D					m_where;
 	Real						m_howFar;
 	PlayerMaskType	m_forWhom;	// ask not for whom the sighting is masked; it masks for thee
+	SightingInfo*	m_nextInQueue;	///< link to the next SightingInfo in the SightingInfoQueue this is in
 
 #if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
 	Bool isJammable;
@@ -271,6 +272,51 @@ protected:
 
 };
 
+//=====================================
+/**
+	TheSuperHackers @performance 18/10/2026
+	A first in first out queue of SightingInfos that links them through m_nextInQueue. The SightingInfos
+	come from their memory pool, so unlike std::queue, pushing and popping never allocates.
+*/
+//=====================================
+class SightingInfoQueue
+{
+public:
+
+	SightingInfoQueue() : m_head(nullptr), m_tail(nullptr), m_size(0) {}
+
+	Bool empty() const { return m_head == nullptr; }
+	Int size() const { return m_size; }
+	SightingInfo *front() const { return m_head; }
+
+	void push(SightingInfo *info)
+	{
+		DEBUG_ASSERTCRASH(info->m_nextInQueue == nullptr, ("SightingInfo is already in a queue"));
+		if (m_tail)
+			m_tail->m_nextInQueue = info;
+		else
+			m_head = info;
+		m_tail = info;
+		++m_size;
+	}
+
+	void pop()
+	{
+		SightingInfo *info = m_head;
+		m_head = info->m_nextInQueue;
+		if (m_head == nullptr)
+			m_tail = nullptr;
+		info->m_nextInQueue = nullptr;
+		--m_size;
+	}
+
+private:
+
+	SightingInfo *m_head;
+	SightingInfo *m_tail;
+	Int m_size;
+};
+
 #if PARTITIONMANAGER_QUEUE_PER_CELL
 // Note that this doesn't extend 'Snapshot'. The missing 'crc' is not handled; there is no equivalent.
 // If that's desired, see where 'crc' is called on SightingInfo's for 'm_pendingUndoShroudReveals', do
@@ -330,24 +376,22 @@ class PartitionCell : public Snapshot	// not MPO: allocated in an array
 {
 private:
 	CellAndObjectIntersection*		m_firstCoiInCell;	///< list of COIs in this cell (may be null).
-	ShroudLevel										m_shroudLevel[MAX_PLAYER_COUNT];
 #ifdef PM_CACHE_TERRAIN_HEIGHT
 	Real													m_loTerrainZ;			///< lowest terrain-pt in this cell
 	Real													m_hiTerrainZ;			///< highest terrain-pt in this cell
 #endif
-	Int														m_threatValue[MAX_PLAYER_COUNT];
-	Int														m_cashValue[MAX_PLAYER_COUNT];
 	Short													m_coiCount;					///< number of COIs in this cell.
 	Short													m_cellX;						///< x-coord of this cell within the Partition Mgr coords (NOT in world coords)
 	Short													m_cellY;						///< y-coord of this cell within the Partition Mgr coords (NOT in world coords)
-	
-#if PARTITIONMANAGER_QUEUE_PER_CELL
-	//std::set<std::multimap<UnsignedInt, CellInfo*>::iterator> undoShroudRevealRefs;
-	//std::unordered_map<UnsignedInt, std::multimap<UnsignedInt, CellInfo*>::iterator> undoShroudRevealRefs;
-	//TempClass undoShroudRevealRefs[2000];
-	//UnsignedInt undoShroudRevealRefs_nextAvailable;
-	std::set<UnsignedInt> undoShroudRevealIds;
-#endif
+	Bool													m_crcDirty;					///< m_cachedCRC is out of date
+	UnsignedInt										m_cachedCRC;				///< CRC of this cell when it was last clean
+
+	// TheSuperHackers @performance 18/10/2026 The per player shroud, threat and cash values of this cell live in
+	// the per player grids of the PartitionManager. This keeps the cells small and a row of values contiguous.
+	Int getCellIndex() const;
+	ShroudLevel& shroudLevelFor( Int playerIndex ) const;
+	UnsignedInt& threatValueFor( Int playerIndex ) const;
+	UnsignedInt& cashValueFor( Int playerIndex ) const;
 
 public:
 
@@ -365,6 +409,13 @@ public:
 	virtual void xfer( Xfer *xfer ) override;
 	virtual void loadPostProcess() override;
 
+	// TheSuperHackers @performance 18/10/2026 Cached CRC for PartitionManager::crcIncremental.
+	// Everything that changes the shroud of this cell must call markCRCDirty.
+	void markCRCDirty() { m_crcDirty = TRUE; }
+	Bool isCRCDirty() const { return m_crcDirty; }
+	UnsignedInt getCachedCRC() const { return m_cachedCRC; }
+	void setCachedCRC( UnsignedInt crc ) { m_cachedCRC = crc; m_crcDirty = FALSE; }
+
 	Int getCoiCount() const { return m_coiCount; }		///< return number of COIs touching this cell.
 	Int getCellX() const { return m_cellX; }
 	Int getCellY() const { return m_cellY; }
@@ -1295,6 +1346,34 @@ protected:
 #endif
 };
 
+//=====================================
+/**
+	TheSuperHackers @performance 18/10/2026
+	A closest object or objects in range query that is split into gathering the candidates, which may run
+	on the worker threads, and merging them on the logic thread. The arguments are the same as for
+	getClosestObject and iterateObjectsInRange.
+*/
+struct PartitionQuery
+{
+	PartitionQuery() :
+		obj(nullptr), pos(nullptr), maxDist(HUGE_DIST), dc(FROM_CENTER_2D), filters(nullptr), iter(nullptr),
+		closestObj(nullptr), closestDist(0.0f)
+	{
+		closestVec.zero();
+	}
+
+	const Object *obj;							///< either obj or pos must be null
+	const Coord3D *pos;
+	Real maxDist;
+	DistanceCalculationType dc;
+	PartitionFilter **filters;
+	SimpleObjectIterator *iter;			///< if nonnull, append ALL satisfactory objects to the iterator (not just the single closest)
+
+	Object *closestObj;							///< result, null if none was found or iter is set
+	Real closestDist;								///< result
+	Coord3D closestVec;							///< result
+};
+
 //=====================================
 /**
 	PartitionManager is the singleton class that manages the entire partition/collision
@@ -1320,10 +1399,15 @@ private:
 	Int							m_cellCountY;			///< number of cells, y
 	Int							m_totalCellCount;	///< x * y
 	PartitionCell*	m_cells;					///< array of cells
+	// TheSuperHackers @performance 18/10/2026 Per player grids of the cell values, indexed by [playerIndex][y * m_cellCountX + x].
+	ShroudLevel*		m_shroudLevels[MAX_PLAYER_COUNT];	///< shroud level of all cells for each player
+	UnsignedInt*		m_threatValues[MAX_PLAYER_COUNT];	///< threat value of all cells for each player
+	UnsignedInt*		m_cashValues[MAX_PLAYER_COUNT];		///< cash value of all cells for each player
 	PartitionData*	m_dirtyModules;
+	PartitionContactList*	m_contactList;	///< contacts found during update, kept to reuse its memory
 	Bool						m_updatedSinceLastReset;	///< Used to force a return of OBJECTSHROUD_INVALID before update has been called.
 
-	std::queue<SightingInfo *> m_pendingUndoShroudReveals;	///< Anything can queue up an Undo to happen later. This is a queue, because "later" is a constant
+	SightingInfoQueue m_pendingUndoShroudReveals;	///< Anything can queue up an Undo to happen later. This is a queue, because "later" is a constant
 #if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
 	// nevermind
 	//std::queue<SightingInfo *> m_pendingUndoShroudRevealsJammable;
@@ -1332,6 +1416,7 @@ private:
 #if PARTITIONMANAGER_QUEUE_PER_CELL
 	std::unordered_map<UnsignedInt, CellInfo*> m_cellInfos;
 	std::multimap<UnsignedInt, UnsignedInt> m_pendingUndoShroudRevealsForCells;
+	std::multimap<Int, UnsignedInt> m_undoShroudRevealIdsForCells;	///< cell index to the ids of its pending undo shroud reveals
 	//std::multimap<UnsignedInt, CellInfo *> m_pendingUndoShroudRevealsForCells;
 	//std::multimap<UnsignedInt, CellInfo *> m_pendingUndoShroudRevealsForCells;
 	//std::queue<CellInfo *> m_pendingUndoShroudRevealsForCells;
@@ -1381,6 +1466,8 @@ protected:
 	void calcRadiusVec();
 #endif
 
+	friend class PartitionCell;
+
 	// These are all friend functions now. They will continue to function as before, but can be passed into
 	// the DiscreteCircle::drawCircle function.
 	friend void hLineAddLooker(Int x1, Int x2, Int y, void *playerIndex);
@@ -1420,6 +1507,8 @@ public:
 	virtual void xfer( Xfer *xfer ) override;
 	virtual void loadPostProcess() override;
 
+	void crcIncremental( Xfer *xfer );	///< same data as crc(), combined from the cached CRC of each cell
+
 	Bool getUpdatedSinceLastReset() const { return m_updatedSinceLastReset; }
 
 	void registerObject( Object *object );				///< add thing to system
@@ -1502,6 +1591,25 @@ public:
 		Coord3D *closestDistVec = nullptr
 	);
 
+#ifdef FASTER_GCO
+	struct QueryCandidate
+	{
+		PartitionData	*module;
+		Real					distSqr;
+		Coord3D				distVec;
+		Int						radius;
+	};
+	typedef std::vector<QueryCandidate> QueryCandidateVec;
+
+	/**
+		Together the same as calling getClosestObject or iterateObjectsInRange for the query. The gather only
+		reads the partitions, so the gathers of several queries may run on the worker threads at once. The
+		merges must then run on the logic thread in query order, because they call the filters.
+	*/
+	void friend_gatherQueryCandidates(const PartitionQuery& query, QueryCandidateVec& candidates);
+	void friend_mergeQueryCandidates(PartitionQuery& query, const QueryCandidateVec& candidates);
+#endif
+
 	Real getRelativeAngle2D( const Object *obj, const Object *otherObj );
 	Real getRelativeAngle2D( const Object *obj, const Coord3D *pos );
 
@@ -414,6 +414,15 @@ protected:
 
 	AttackPriorityInfo *findAttackInfo(const AsciiString& name, Bool addIfNotFound);
 
+	// TheSuperHackers @performance 18/10/2026 Named object cache maintenance. m_namedObjects keeps its order,
+	// the indices point at the first entry with a given name or object, like the linear searches did.
+	Int findNamedObjectByName(const AsciiString& name) const;	///< index into m_namedObjects, or -1
+	Int findNamedObjectByObject(const Object *obj) const;			///< index into m_namedObjects, or -1
+	void addNamedObject(const AsciiString& name, Object *obj);
+	void setNamedObjectName(Int index, const AsciiString& name);
+	void setNamedObject(Int index, Object *obj);
+	void clearNamedObjects();
+
 protected:
 	/// Stuff to execute scripts sequentially
 	typedef std::vector<SequentialScript*> VecSequentialScriptPtr;
@@ -446,6 +455,12 @@ protected:
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+
+	typedef std::hash_map<AsciiString, Int, rts::hash<AsciiString>, rts::equal_to<AsciiString> > NamedObjectNameIndex;
+	typedef std::hash_map<ObjectID, Int, rts::hash<ObjectID>, rts::equal_to<ObjectID> > NamedObjectIDIndex;
+	NamedObjectNameIndex	m_namedObjectNameIndex;	///< first m_namedObjects entry with the name
+	NamedObjectIDIndex	m_namedObjectIDIndex;			///< first m_namedObjects entry with the object
+
 	Bool							m_firstUpdate;
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
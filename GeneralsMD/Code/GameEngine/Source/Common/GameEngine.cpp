@@ -40,6 +40,7 @@
 #include "Common/GameAudio.h"
 #include "Common/GameEngine.h"
 #include "Common/INI.h"
+#include "Common/INICache.h"
 #include "Common/INIException.h"
 #include "Common/MessageStream.h"
 #include "Common/ThingFactory.h"
@@ -64,6 +65,7 @@
 #include "Common/SpecialPower.h"
 #include "Common/TerrainTypes.h"
 #include "Common/Upgrade.h"
+#include "Common/WorkerThreadPool.h"
 #include "Common/OptionPreferences.h"
 #include "Common/Xfer.h"
 #include "Common/XferCRC.h"
@@ -291,6 +293,12 @@ GameEngine::~GameEngine()
 	delete TheNameKeyGenerator;
 	TheNameKeyGenerator = nullptr;
 
+	delete TheWorkerThreadPool;
+	TheWorkerThreadPool = nullptr;
+
+	delete TheINICache;
+	TheINICache = nullptr;
+
 	delete TheFileSystem;
 	TheFileSystem = nullptr;
 
@@ -404,6 +412,10 @@ void GameEngine::init()
 		TheNameKeyGenerator = MSGNEW("GameEngineSubsystem") NameKeyGenerator;
 		TheNameKeyGenerator->init();
 
+		// not part of the subsystem list, because the threads are kept for the whole session.
+		TheWorkerThreadPool = MSGNEW("GameEngineSubsystem") WorkerThreadPool;
+		TheWorkerThreadPool->init(WorkerThreadPool::getDefaultNumThreads());
+
 
     	#ifdef DUMP_PERF_STATS///////////////////////////////////////////////////////////////////////////
 	GetPrecisionTimer(&endTime64);//////////////////////////////////////////////////////////////////
@@ -454,6 +466,16 @@ void GameEngine::init()
 		initSubsystem(TheWritableGlobalData, "TheWritableGlobalData", TheWritableGlobalData, &xferCRC, "Data\\INI\\Default\\GameData", "Data\\INI\\GameData");
 		TheWritableGlobalData->parseCustomDefinition();
 
+		// TheSuperHackers @performance 18/10/2026 Not part of the subsystem list, because it is only needed while loading.
+		// It is created after TheWritableGlobalData, because the cache file is in the user data folder.
+		TheINICache = MSGNEW("GameEngineSubsystem") INICache;
+		if (TheGlobalData->m_useINICache)
+		{
+			AsciiString cacheFilename = TheGlobalData->getPath_UserData();
+			cacheFilename.concat("INICache.dat");
+			TheINICache->load(cacheFilename);
+		}
+
 
 	#ifdef DUMP_PERF_STATS///////////////////////////////////////////////////////////////////////////
 	GetPrecisionTimer(&endTime64);//////////////////////////////////////////////////////////////////
@@ -474,6 +496,12 @@ void GameEngine::init()
 
 		TheArchiveFileSystem->loadMods();
 
+		// TheSuperHackers @performance 18/10/2026 The subsystems below must still parse their INI files one after
+		// the other, because the parsers look up what the subsystems before them have parsed and NameKeys are
+		// assigned in parse order. What does not depend on the order is reading the files and splitting them into
+		// lines, so that is done for all of them here at once, with the line splitting spread over the worker threads.
+		TheINICache->prefetchDirectory("Data\\INI");
+
 		// doesn't require resets so just create a single instance here.
 		TheGameLODManager = MSGNEW("GameEngineSubsystem") GameLODManager;
 		TheGameLODManager->init();
@@ -552,7 +580,10 @@ void GameEngine::init()
 		initSubsystem(TheCaveSystem,"TheCaveSystem", MSGNEW("GameEngineSubsystem") CaveSystem(), nullptr);
 		initSubsystem(TheRankInfoStore,"TheRankInfoStore", MSGNEW("GameEngineSubsystem") RankInfoStore(), &xferCRC, nullptr, "Data\\INI\\Rank");
 		initSubsystem(ThePlayerTemplateStore,"ThePlayerTemplateStore", MSGNEW("GameEngineSubsystem") PlayerTemplateStore(), &xferCRC, "Data\\INI\\Default\\PlayerTemplate", "Data\\INI\\PlayerTemplate");
-		initSubsystem(TheParticleSystemManager,"TheParticleSystemManager", createParticleSystemManager(TheGlobalData->m_headless), nullptr);
+		// TheSuperHackers @performance 18/10/2026 -replayParticles simulates the particle systems in Headless Mode.
+		ParticleSystemManager *particleSystemManager = (TheGlobalData->m_headless && TheGlobalData->m_simulateReplayParticles)
+			? NEW ParticleSystemManagerHeadless : createParticleSystemManager(TheGlobalData->m_headless);
+		initSubsystem(TheParticleSystemManager,"TheParticleSystemManager", particleSystemManager, nullptr);
 
 	#ifdef DUMP_PERF_STATS///////////////////////////////////////////////////////////////////////////
 	GetPrecisionTimer(&endTime64);//////////////////////////////////////////////////////////////////
@@ -756,6 +787,10 @@ void GameEngine::init()
 			}
 		}
 
+		TheINICache->save();
+		delete TheINICache;
+		TheINICache = nullptr;
+
 	}
 	catch (ErrorCode ec)
 	{
@@ -31,6 +31,10 @@
 #include "Common/Player.h"
 #include "Common/GlobalData.h"
 #include "Common/GameEngine.h"
+#include "Common/GameState.h"
+#include "Common/LatchRestore.h"
+#include "Common/XferLoad.h"
+#include "Common/XferSave.h"
 #include "GameClient/ClientInstance.h"
 #include "GameClient/GameWindow.h"
 #include "GameClient/GameWindowManager.h"
@@ -42,6 +46,8 @@
 #include "GameNetwork/GameMessageParser.h"
 #include "GameNetwork/GameSpy/PeerDefs.h"
 #include "GameNetwork/networkutil.h"
+#include "GameLogic/AI.h"
+#include "GameLogic/AIPathfind.h"
 #include "GameLogic/GameLogic.h"
 #include "Common/RandomValue.h"
 #include "Common/CRCDebug.h"
@@ -55,6 +61,7 @@ Int REPLAY_CRC_INTERVAL = 100;
 
 const char *replayExtention = ".rep";
 const char *lastReplayFileName = "00000000";	// a name the user is unlikely to ever type, but won't cause panic & confusion
+static const char *replaySnapshotDir = "ReplaySnapshots\\";	// relative to the save directory
 
 // TheSuperHackers @tweak helmutbuhler 25/04/2025
 // The replay header contains two time fields; startTime and endTime of type time_t.
@@ -75,11 +82,11 @@ static void writeAtOffset(File* file, Int offset, const void* data, Int dataSize
 {
 	UnsignedInt fileSize = file->size();
 	DEBUG_ASSERTCRASH((UnsignedInt)(offset + dataSize) <= fileSize, ("writeAtOffset would exceed file size!"));
-	if (file->seek(offset, File::seekMode::START) == offset)
+	if (file->seek(offset, File::START) == offset)
 	{
 		file->write(data, dataSize);
 	}
-	MAYBE_UNUSED Int res = file->seek(fileSize, File::seekMode::START);
+	MAYBE_UNUSED Int res = file->seek(fileSize, File::START);
 	(void)res;
 	DEBUG_ASSERTCRASH(res == fileSize, ("Could not seek to end of file!"));
 }
@@ -130,6 +137,34 @@ void RecorderClass::CRCInfo::addCRC(UnsignedInt val)
 	//DEBUG_LOG(("CRCInfo::addCRC() - crc %8.8X pushes list to %d entries (full=%d)", val, m_data.size(), !m_data.empty()));
 }
 
+void RecorderClass::CRCInfo::xfer(Xfer *xfer)
+{
+	xfer->xferBool(&m_sawCRCMismatch);
+	xfer->xferBool(&m_skippedOne);
+	xfer->xferUnsignedInt(&m_localPlayer);
+
+	UnsignedInt count = m_data.size();
+	xfer->xferUnsignedInt(&count);
+	if (xfer->getXferMode() == XFER_LOAD)
+	{
+		m_data.clear();
+		for (UnsignedInt i = 0; i < count; ++i)
+		{
+			UnsignedInt val = 0;
+			xfer->xferUnsignedInt(&val);
+			m_data.push_back(val);
+		}
+	}
+	else
+	{
+		for (std::list<UnsignedInt>::iterator it = m_data.begin(); it != m_data.end(); ++it)
+		{
+			UnsignedInt val = *it;
+			xfer->xferUnsignedInt(&val);
+		}
+	}
+}
+
 UnsignedInt RecorderClass::CRCInfo::readCRC()
 {
 	if (m_data.empty())
@@ -346,6 +381,7 @@ RecorderClass::RecorderClass()
 	m_archiveReplays = FALSE;
 	m_nextFrame = 0;
 	m_wasDesync = FALSE;
+	m_isLoadingPlaybackSnapshot = FALSE;
 	init(); // just for the heck of it.
 }
 
@@ -387,6 +423,10 @@ void RecorderClass::init() {
  * Reset the recorder to the "initialized state."
  */
 void RecorderClass::reset() {
+	// A replay resumed from a snapshot is opened before the snapshot load resets the subsystems.
+	if (m_isLoadingPlaybackSnapshot)
+		return;
+
 	if (m_file != nullptr) {
 		m_file->close();
 		m_file = nullptr;
@@ -950,7 +990,11 @@ Bool RecorderClass::readReplayHeader(ReplayHeader& header)
 
 Bool RecorderClass::simulateReplay(AsciiString filename)
 {
-	Bool success = playbackFile(filename);
+	Bool success;
+	if (TheGlobalData->m_replayResumeFrame != 0)
+		success = playbackFileFromSnapshot(filename, TheGlobalData->m_replayResumeFrame);
+	else
+		success = playbackFile(filename);
 	if (success)
 		m_mode = RECORDERMODETYPE_SIMULATION_PLAYBACK;
 	return success;
@@ -1079,20 +1123,10 @@ Bool RecorderClass::replayMatchesGameVersion(const ReplayHeader& header)
 }
 
 /**
- * Start playback of the file. Return true or false depending on if the file is
- * a valid replay file or not.
+ * Read the replay header and the game setup that follows it. On success m_file is positioned at the first frame.
  */
-Bool RecorderClass::playbackFile(AsciiString filename)
+Bool RecorderClass::openPlaybackFile(AsciiString filename, ReplayHeader& header, Int& difficulty, Int& rankPoints, Int& maxFPS)
 {
-	if (!m_doingAnalysis)
-	{
-		if (TheGameLogic->isInGame())
-		{
-			TheGameLogic->clearGameData();
-		}
-	}
-
-	ReplayHeader header;
 	header.forPlayback = TRUE;
 	header.filename = filename;
 	Bool success = readReplayHeader( header );
@@ -1162,17 +1196,43 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 	REPLAY_CRC_INTERVAL = m_gameInfo.getCRCInterval();
 	DEBUG_LOG(("Player index is %d, replay CRC interval is %d", m_crcInfo.getLocalPlayer(), REPLAY_CRC_INTERVAL));
 
-	Int difficulty = 0;
+	difficulty = 0;
 	m_file->read(&difficulty, sizeof(difficulty));
 
 	m_file->read(&m_originalGameMode, sizeof(m_originalGameMode));
 
-	Int rankPoints = 0;
+	rankPoints = 0;
 	m_file->read(&rankPoints, sizeof(rankPoints));
 
-	Int maxFPS = 0;
+	maxFPS = 0;
 	m_file->read(&maxFPS, sizeof(maxFPS));
 
+	return TRUE;
+}
+
+/**
+ * Start playback of the file. Return true or false depending on if the file is
+ * a valid replay file or not.
+ */
+Bool RecorderClass::playbackFile(AsciiString filename)
+{
+	if (!m_doingAnalysis)
+	{
+		if (TheGameLogic->isInGame())
+		{
+			TheGameLogic->clearGameData();
+		}
+	}
+
+	ReplayHeader header;
+	Int difficulty = 0;
+	Int rankPoints = 0;
+	Int maxFPS = 0;
+	if (!openPlaybackFile(filename, header, difficulty, rankPoints, maxFPS))
+	{
+		return FALSE;
+	}
+
 	DEBUG_LOG(("RecorderClass::playbackFile() - original game was mode %d", m_originalGameMode));
 
 	// TheSuperHackers @fix helmutbuhler 03/04/2025
@@ -1216,6 +1276,227 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 	return TRUE;
 }
 
+/**
+ * Returns the save file name of a replay snapshot, relative to the save directory.
+ */
+AsciiString RecorderClass::getPlaybackSnapshotName(AsciiString replayFilename, UnsignedInt frame)
+{
+	// Flatten replays in sub folders into one snapshot folder.
+	AsciiString name;
+	const Int nameLength = replayFilename.getLength() - getReplayExtention().getLength();
+	for (Int i = 0; i < nameLength; ++i)
+	{
+		const char c = replayFilename.getCharAt(i);
+		name.concat((c == '\\' || c == '/') ? '_' : c);
+	}
+
+	AsciiString snapshotName;
+	snapshotName.format("%s%s_%08u.sav", replaySnapshotDir, name.str(), frame);
+	return snapshotName;
+}
+
+/**
+ * Returns the name of the latest snapshot of the replay at or before the given frame, or an empty string.
+ */
+AsciiString RecorderClass::findPlaybackSnapshot(AsciiString replayFilename, UnsignedInt frame)
+{
+	FilenameList files;
+	TheFileSystem->getFileListInDirectory(TheGameState->getFilePathInSaveDirectory(replaySnapshotDir), "*.sav", files, FALSE);
+
+	AsciiString best;
+	UnsignedInt bestFrame = 0;
+	for (FilenameList::iterator it = files.begin(); it != files.end(); ++it)
+	{
+		const char *underscore = strrchr(it->str(), '_');
+		if (underscore == nullptr)
+			continue;
+		const UnsignedInt snapshotFrame = strtoul(underscore + 1, nullptr, 10);
+		if (snapshotFrame == 0 || snapshotFrame > frame || snapshotFrame <= bestFrame)
+			continue;
+
+		// Make sure that the snapshot belongs to this replay and not to one with a similar name.
+		// The compared leaf includes the directory separator in front of it.
+		AsciiString snapshotName = getPlaybackSnapshotName(replayFilename, snapshotFrame);
+		if (!it->endsWithNoCase(snapshotName.str() + strlen(replaySnapshotDir) - 1))
+			continue;
+
+		bestFrame = snapshotFrame;
+		best = snapshotName;
+	}
+	return best;
+}
+
+/**
+ * The playback state that is not covered by the save game: the replay read position, the pending CRCs,
+ * the logic random generator and the pathfinder. The logic CRC at the time of the snapshot is kept with
+ * it, so that a resumed playback can verify that it continues from the same state.
+ * Version Info:
+ * 1: Initial version
+ * 2: The pathfinder and the logic CRC
+ */
+void RecorderClass::xferPlaybackState(Xfer *xfer, UnsignedInt &logicCRC)
+{
+	XferVersion currentVersion = 2;
+	XferVersion version = currentVersion;
+	xfer->xferVersion( &version, currentVersion );
+
+	Int filePosition = m_file->position();
+	xfer->xferInt( &filePosition );
+	if (xfer->getXferMode() == XFER_LOAD)
+		m_file->seek(filePosition, File::START);
+
+	xfer->xferUnsignedInt( &m_nextFrame );
+	m_crcInfo.xfer( xfer );
+
+	UnsignedInt randomState[GAME_LOGIC_RANDOM_STATE_SIZE];
+	UnsignedInt randomBaseSeed;
+	GetGameLogicRandomState(randomState, randomBaseSeed);
+	for (Int i = 0; i < GAME_LOGIC_RANDOM_STATE_SIZE; ++i)
+		xfer->xferUnsignedInt( &randomState[i] );
+	xfer->xferUnsignedInt( &randomBaseSeed );
+	if (xfer->getXferMode() == XFER_LOAD)
+		SetGameLogicRandomState(randomState, randomBaseSeed);
+
+	// The save game has no pathfinder block, but the pathfind queue and its cell counters are part of the CRC.
+	if (version >= 2)
+	{
+		xfer->xferSnapshot( TheAI->pathfinder() );
+		xfer->xferUnsignedInt( &logicCRC );
+	}
+	else
+	{
+		logicCRC = 0;
+	}
+}
+
+/**
+ * Write a snapshot of the game and the playback state. This is called at the start of a logic frame,
+ * before anything of that frame is executed, so that a resumed playback runs the same frame again.
+ */
+void RecorderClass::updatePlaybackSnapshot()
+{
+	const UnsignedInt interval = TheGlobalData->m_replaySnapshotInterval;
+	if (interval == 0 || !isPlaybackInProgress())
+		return;
+
+	const UnsignedInt frame = TheGameLogic->getFrame();
+	if (frame == 0 || frame % interval != 0)
+		return;
+
+	const AsciiString snapshotName = getPlaybackSnapshotName(m_currentReplayFilename, frame);
+	CreateDirectory(TheGameState->getSaveDirectory().str(), nullptr);
+	CreateDirectory(TheGameState->getFilePathInSaveDirectory(replaySnapshotDir).str(), nullptr);
+
+	SaveResult result = TheGameState->saveGame(snapshotName, UnicodeString::TheEmptyString, SAVE_FILE_TYPE_NORMAL);
+	if (result.saveCode != SC_OK)
+	{
+		DEBUG_LOG(("RecorderClass::updatePlaybackSnapshot - failed to save snapshot '%s'", snapshotName.str()));
+		return;
+	}
+
+	AsciiString statePath = TheGameState->getFilePathInSaveDirectory(snapshotName);
+	statePath.truncateBy(3);
+	statePath.concat("rps");
+
+	UnsignedInt logicCRC = TheGameLogic->getCRC(CRC_RECALC);
+	XferSave xferSave;
+	try
+	{
+		xferSave.open(statePath);
+		xferPlaybackState(&xferSave, logicCRC);
+	}
+	catch (...)
+	{
+		DEBUG_LOG(("RecorderClass::updatePlaybackSnapshot - failed to save playback state '%s'", statePath.str()));
+	}
+	xferSave.close();
+}
+
+/**
+ * Resume the playback of a replay from the latest snapshot at or before the given frame. Plays the replay
+ * from the start if it has no snapshot yet. Fails if a snapshot exists but cannot be loaded.
+ */
+Bool RecorderClass::playbackFileFromSnapshot(AsciiString filename, UnsignedInt frame)
+{
+	const AsciiString snapshotName = findPlaybackSnapshot(filename, frame);
+	if (snapshotName.isEmpty())
+	{
+		printf("No snapshot at or before frame %u, playing from the start\n", frame);
+		return playbackFile(filename);
+	}
+
+	AsciiString statePath = TheGameState->getFilePathInSaveDirectory(snapshotName);
+	statePath.truncateBy(3);
+	statePath.concat("rps");
+
+	if (TheGameLogic->isInGame())
+		TheGameLogic->clearGameData();
+
+	// The replay is opened and the recorder is in playback mode before the snapshot is loaded, so that
+	// the game started by the load takes its players from the replay game info.
+	ReplayHeader header;
+	Int difficulty = 0;
+	Int rankPoints = 0;
+	Int maxFPS = 0;
+	if (!openPlaybackFile(filename, header, difficulty, rankPoints, maxFPS))
+		return FALSE;
+
+	m_mode = RECORDERMODETYPE_PLAYBACK;
+	m_currentReplayFilename = filename;
+	m_playbackFrameCount = header.frameCount;
+
+	SaveCode loadResult;
+	{
+		// Loading the game resets all subsystems. The recorder keeps its playback state through that.
+		LatchRestore<Bool> keepPlayback(m_isLoadingPlaybackSnapshot, TRUE);
+		AvailableGameInfo gameInfo;
+		gameInfo.filename = snapshotName;
+		TheGameState->getSaveGameInfoFromFile(snapshotName, &gameInfo.saveGameInfo);
+		loadResult = TheGameState->loadGame(gameInfo);
+	}
+	if (loadResult != SC_OK)
+	{
+		printf("Cannot load snapshot \"%s\" (error %d)\n", snapshotName.str(), (Int)loadResult);
+		reset();
+		return FALSE;
+	}
+
+	XferLoad xferLoad;
+	Bool stateLoaded = TRUE;
+	UnsignedInt snapshotCRC = 0;
+	try
+	{
+		xferLoad.open(statePath);
+		// The game state is already post processed by the load above.
+		xferLoad.setOptions(XO_NO_POST_PROCESSING);
+		xferPlaybackState(&xferLoad, snapshotCRC);
+	}
+	catch (...)
+	{
+		stateLoaded = FALSE;
+	}
+	xferLoad.close();
+	if (!stateLoaded)
+	{
+		printf("Cannot load playback state \"%s\"\n", statePath.str());
+		TheGameLogic->clearGameData();
+		return FALSE;
+	}
+
+	// A snapshot that does not restore the exact logic state would only produce a CRC mismatch later on.
+	// Snapshots of version 1 have no CRC and are rejected here as well.
+	const UnsignedInt logicCRC = TheGameLogic->getCRC(CRC_RECALC);
+	if (logicCRC != snapshotCRC)
+	{
+		printf("Snapshot \"%s\" does not match the replay (CRC 0x%8.8X, expected 0x%8.8X)\n", snapshotName.str(), logicCRC, snapshotCRC);
+		TheGameLogic->clearGameData();
+		return FALSE;
+	}
+
+	TheCommandList->reset();
+	return TRUE;
+}
+
 /**
  * Read a unicode string from the current file position. The string is assumed to be 0-terminated.
  */
@@ -29,6 +29,7 @@
 
 #include "Common/CRCDebug.h"
 #include "Common/GameState.h"
+#include "Common/LogicFrameProfile.h"
 #include "Common/PerfTimer.h"
 #include "Common/Player.h"
 #include "Common/PlayerList.h"
@@ -187,6 +188,8 @@ static const FieldParse TheAIFieldParseTable[] =
 
  	{ "InfantryPathfindDiameter",		INI::parseInt,nullptr,			offsetof( TAiData, m_infantryPathfindDiameter ) },
  	{ "VehiclePathfindDiameter",		INI::parseInt,nullptr,			offsetof( TAiData, m_vehiclePathfindDiameter ) },
+ 	{ "PathfindCellsPerFrame",		INI::parseInt,nullptr,			offsetof( TAiData, m_pathfindCellsPerFrame ) },
+ 	{ "PathfindCarryOverCells",		INI::parseBool,nullptr,			offsetof( TAiData, m_pathfindCarryOverCells ) },
  	{ "RebuildDelayTimeSeconds",		INI::parseInt,nullptr,			offsetof( TAiData, m_rebuildDelaySeconds ) },
  	{ "SupplyCenterSafeRadius",			INI::parseReal,nullptr,			offsetof( TAiData, m_supplyCenterSafeRadius ) },
 
@@ -356,7 +359,10 @@ void AI::reset()
 void AI::update()
 {
 	// Do pathfinding.
-	m_pathfinder->processPathfindQueue();
+	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_PATHFIND_QUEUE)
+		m_pathfinder->processPathfindQueue();
+	}
 
 	// run player updates
 	{
@@ -955,6 +961,8 @@ m_minDistanceForGroup(100),
 m_minClumpDensity(0.5f),
 m_infantryPathfindDiameter(6),
 m_vehiclePathfindDiameter(6),
+m_pathfindCellsPerFrame(DEFAULT_PATHFIND_CELLS_PER_FRAME),
+m_pathfindCarryOverCells(false),
 m_supplyCenterSafeRadius(250),
 m_rebuildDelaySeconds(10),
 m_distanceRequiresGroup(0.0f),
@@ -995,6 +1003,12 @@ void TAiData::crc( Xfer *xfer )
 	xfer->xferReal( &m_skirmishBaseDefenseExtraDistance );
 	xfer->xferReal( &m_repulsedDistance );
 	xfer->xferBool( &m_enableRepulsors );
+	// TheSuperHackers @performance 18/10/2026 Only when the pathfind budget is changed, so that the CRC does not change otherwise.
+	if (m_pathfindCellsPerFrame != DEFAULT_PATHFIND_CELLS_PER_FRAME || m_pathfindCarryOverCells)
+	{
+		xfer->xferInt( &m_pathfindCellsPerFrame );
+		xfer->xferBool( &m_pathfindCarryOverCells );
+	}
 	CRCGEN_LOG(("CRC after AI TAiData for frame %d is 0x%8.8X", TheGameLogic->getFrame(), ((XferCRC *)xfer)->getCRC()));
 
 }
@@ -5419,6 +5419,7 @@ void AIAttackFireWeaponState::onExit( StateExitType status )
 	Weapon* weapon = obj->getCurrentWeapon();
 	if (weapon && weapon->getStatus() == PRE_ATTACK)
 	{
+		obj->markCRCDirty();
 		weapon->setPreAttackFinishedFrame(0);
 	}
 }
@@ -5641,6 +5642,7 @@ StateReturnType AIAttackState::onEnter()
 	Weapon* curWeapon = source->getCurrentWeapon();
 	if (curWeapon)
 	{
+		source->markCRCDirty();
 		curWeapon->setMaxShotCount(NO_MAX_SHOTS_LIMIT);
 		// icky special case for ignoring stealth units we might be targeting, that are currently stealthed. (srj)
 		if (curWeapon->getContinueAttackRange() > 0.0f)
@@ -329,6 +329,7 @@ void TransportContain::onContaining( Object *rider, Bool wasSelected )
 		if( bikeWeapon && riderWeapon )
 		{
 			//Transfer the reload time from the rider to the bike
+			getObject()->markCRCDirty();
 			bikeWeapon->transferNextShotStatsFrom( *riderWeapon );
 		}
 	}
@@ -438,6 +439,7 @@ void TransportContain::onRemoving( Object *rider )
 		if( bikeWeapon && riderWeapon )
 		{
 			//Transfer the reload time from the bike to the rider
+			rider->markCRCDirty();
 			riderWeapon->transferNextShotStatsFrom( *bikeWeapon );
 		}
 	}
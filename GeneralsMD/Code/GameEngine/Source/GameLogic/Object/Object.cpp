@@ -310,6 +310,8 @@ Object::Object( const ThingTemplate *tt ) :
 	m_partitionLastValue(nullptr),
 	m_smcUntil(NEVER),
 	m_privateStatus(0),
+	m_crcDirty(TRUE),
+	m_cachedCRC(0),
 	m_formationID(NO_FORMATION_ID),
 	m_isReceivingDifficultyBonus(FALSE),
 	m_singleUseCommandUsed(FALSE),
@@ -375,6 +377,8 @@ Object::Object(const ThingTemplate* tt, Team* team, const ObjectStatusMaskType&
 	m_partitionLastValue(nullptr),
 	m_smcUntil(NEVER),
 	m_privateStatus(0),
+	m_crcDirty(TRUE),
+	m_cachedCRC(0),
 	m_formationID(NO_FORMATION_ID),
 	m_isReceivingDifficultyBonus(FALSE),
 	m_singleUseCommandUsed(FALSE),
@@ -869,6 +873,7 @@ void Object::loadInit()
 //-------------------------------------------------------------------------------------------------
 void Object::initObject()
 {
+	markCRCDirty();
 	// Weapons & Damage -------------------------------------------------------------------------------------------------
 	// Force the initial weapon set to be instantiated & reloaded.
 
@@ -1374,6 +1379,7 @@ void Object::setGeometryInfoZ( Real newZ )
 //=============================================================================
 void Object::friend_setUndetectedDefector( Bool status )
 {
+	markCRCDirty();
 	if (status)
 		m_privateStatus |= UNDETECTED_DEFECTOR;
 	else
@@ -1870,6 +1876,7 @@ Bool Object::testArmorSetFlag(ArmorSetType ast) const
 //=============================================================================
 void Object::reloadAllAmmo(Bool now)
 {
+	markCRCDirty();
 	m_weaponSet.reloadAllAmmo(this, now);
 }
 
@@ -2120,6 +2127,7 @@ Bool Object::chooseBestWeaponForTarget(const Object* target, WeaponChoiceCriteri
 //=============================================================================
 void Object::fireCurrentWeapon(Object *target)
 {
+	markCRCDirty();
 	//USE_PERF_TIMER(fireCurrentWeapon)
 
 	// victim may have already been destroyed
@@ -2146,6 +2154,7 @@ void Object::fireCurrentWeapon(Object *target)
 //=============================================================================
 void Object::fireCurrentWeapon(const Coord3D* pos)
 {
+	markCRCDirty();
 	//USE_PERF_TIMER(fireCurrentWeapon)
 
 	if (pos == nullptr)
@@ -2179,6 +2188,7 @@ void Object::notifyFiringTrackerShotFired( const Weapon* weaponFired, ObjectID v
 //=============================================================================
 void Object::preFireCurrentWeapon( const Object *victim )
 {
+	markCRCDirty();
 	Weapon* weapon = m_weaponSet.getCurWeapon();
 
 	//If we are going to be capable of firing our weapon NEXT frame, set the pre-attack
@@ -2472,6 +2482,7 @@ void Object::reactToTurretChange( WhichTurretType turret, Real oldRotation, Real
 //DECLARE_PERF_TIMER(Object_reactToTransformChange)
 void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle)
 {
+	markCRCDirty();
 	//USE_PERF_TIMER(Object_reactToTransformChange)
 	if(_isnan(getPosition()->x) || _isnan(getPosition()->y) || _isnan(getPosition()->z)) {
 		DEBUG_CRASH(("Object pos is nan."));
@@ -2692,6 +2703,7 @@ void Object::healCompletely()
 //-------------------------------------------------------------------------------------------------
 void Object::setEffectivelyDead(Bool dead)
 {
+	markCRCDirty();
 	if (dead)
 		BitSet(m_privateStatus, EFFECTIVELY_DEAD);
 	else
@@ -2707,6 +2719,7 @@ void Object::setEffectivelyDead(Bool dead)
 //-------------------------------------------------------------------------------------------------
 void Object::setCaptured(Bool isCaptured)
 {
+	markCRCDirty();
 	if (isCaptured)
 		BitSet(m_privateStatus, CAPTURED);
 	else
@@ -3649,6 +3662,7 @@ void Object::friend_prepareForMapBoundaryAdjust()
 //-------------------------------------------------------------------------------------------------
 void Object::friend_notifyOfNewMapBoundary()
 {
+	markCRCDirty();
 	ThePartitionManager->registerObject(this);
 	TheRadar->addObject(this);
 	TheAI->pathfinder()->addObjectToPathfindMap( this );
@@ -3901,6 +3915,7 @@ Bool Object::isMassSelectable() const
 //-------------------------------------------------------------------------------------------------
 void Object::setWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -3912,6 +3927,7 @@ void Object::setWeaponSetFlag(WeaponSetType wst)
 //-------------------------------------------------------------------------------------------------
 void Object::clearWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst, 0);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -3945,6 +3961,7 @@ void Object::clearWeaponSetFlagNoEvent(WeaponSetType wst)
 //MODDD
 void Object::updateWeaponSet()
 {
+	markCRCDirty();
 	m_weaponSet.updateWeaponSet(this);
 }
 
@@ -5595,6 +5612,7 @@ Bool Object::affectedByUpgrade( const UpgradeTemplate *upgradeT ) const
 //-------------------------------------------------------------------------------------------------
 void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 {
+	markCRCDirty();
 	if (upgradeT)
 	{
 		m_objectUpgradesCompleted.set( upgradeT->getUpgradeMask() );
@@ -5615,6 +5633,7 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 //-------------------------------------------------------------------------------------------------
 void Object::removeUpgrade( const UpgradeTemplate *upgradeT )
 {
+	markCRCDirty();
 	m_objectUpgradesCompleted.clear( upgradeT->getUpgradeMask() );
 	for (BehaviorModule** module = m_behaviors; *module; ++module)
 	{
@@ -5834,6 +5853,7 @@ void Object::onDie( DamageInfo *damageInfo )
 //-------------------------------------------------------------------------------------------------
 void Object::setWeaponBonusCondition(WeaponBonusConditionType wst)
 {
+	markCRCDirty();
 	WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 	m_weaponBonusCondition |= (1 << wst);
 
@@ -5847,6 +5867,7 @@ void Object::setWeaponBonusCondition(WeaponBonusConditionType wst)
 //-------------------------------------------------------------------------------------------------
 void Object::clearWeaponBonusCondition(WeaponBonusConditionType wst)
 {
+	markCRCDirty();
 	WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 	m_weaponBonusCondition &= ~(1 << wst);
 
@@ -5860,11 +5881,13 @@ void Object::clearWeaponBonusCondition(WeaponBonusConditionType wst)
 //MODDD - variants that don't cause 'weaponSetOnWeaponBonusChange'. The caller can handle that.
 void Object::setWeaponBonusConditionNoEvent(WeaponBonusConditionType wst)
 {
+	markCRCDirty();
 	m_weaponBonusCondition |= (1 << wst);
 }
 
 void Object::clearWeaponBonusConditionNoEvent(WeaponBonusConditionType wst)
 {
+	markCRCDirty();
 	m_weaponBonusCondition &= ~(1 << wst);
 }
 
@@ -5872,12 +5895,14 @@ void Object::clearWeaponBonusConditionNoEvent(WeaponBonusConditionType wst)
 // Note that if the 'source' object isn't the same as 'this', it should be a param like in WeaponSet's method.
 void Object::weaponSetOnWeaponBonusChange()
 {
+	markCRCDirty();
 	m_weaponSet.weaponSetOnWeaponBonusChange(this);
 }
 
 //MODDD
 void Object::onDoWeaponCommand()
 {
+	markCRCDirty();
 	m_weaponSet.onDoWeaponCommand(this);
 }
 
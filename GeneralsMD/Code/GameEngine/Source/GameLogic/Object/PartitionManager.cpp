@@ -63,6 +63,7 @@
 #include "Common/ThingFactory.h"	// for bullet type hack
 #include "Common/ThingTemplate.h"
 #include "Common/Xfer.h"
+#include "Common/XferCRC.h"
 
 #include "GameLogic/AIPathfind.h"
 #include "GameLogic/GameLogic.h"
@@ -1004,46 +1005,33 @@ PartitionManager *ThePartitionManager = nullptr;  ///< the object manager single
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
-class PartitionContactListNode : public MemoryPoolObject
-{
-	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(PartitionContactListNode, "PartitionContactListNode" )
-
-public:
-	PartitionContactListNode*			m_nextHash;	///< next node with same hash value
-	PartitionContactListNode*			m_next;			///< next node
-	PartitionData*								m_obj;			///< one object that is possibly colliding
-	PartitionData*								m_other;		///< the other object (or null for collisions with the terrain)
-	Int														m_hashValue;///< index into hash table
-};
-
-inline PartitionContactListNode::~PartitionContactListNode() { }
-
-//-----------------------------------------------------------------------------
-
+// TheSuperHackers @performance 18/10/2026 The contacts of a frame are kept in one array in the order they
+// were found, instead of a pool allocated node per contact in a 5381 socket chained hash that had to be
+// cleared every frame. Duplicates are found with an open addressing table of the object ID pairs. Both
+// arrays keep their memory from frame to frame. The contacts are processed in reverse order of addition,
+// like the old list that added each new contact at its head, so onCollide is called in the same order.
 class PartitionContactList
 {
 private:
 
-	/*
-		socketcount should be prime (and "not too close to a power of 2) for best results.
+	struct Contact
+	{
+		PartitionData*		m_obj;			///< one object that is possibly colliding
+		PartitionData*		m_other;		///< the other object
+		UnsignedInt				m_slot;			///< index into m_slots
+	};
 
-		if this one isn't large enough, try this website:
-		http://www.utm.edu/research/primes/lists/small/1000.txt
+	enum { MIN_SLOT_COUNT = 1024 };	///< must be a power of 2
 
-		So how is this chosen? Eh, pretty much based on experimentation.
-	*/
-	enum { PartitionContactList_SOCKET_COUNT = 5381 };
+	std::vector<Contact>				m_contacts;	///< contacts of this frame, in order of addition
+	std::vector<UnsignedInt64>	m_slots;		///< ID pair of each contact, 0 for empty slots
 
-
-	PartitionContactListNode* m_contactHash[PartitionContactList_SOCKET_COUNT];
-	PartitionContactListNode* m_contactList;
+	void growSlots();
 
 public:
 
-	PartitionContactList()
+	PartitionContactList() : m_slots(MIN_SLOT_COUNT, 0)
 	{
-		memset(m_contactHash, 0, sizeof(m_contactHash));
-		m_contactList = nullptr;
 	}
 
 	~PartitionContactList()
@@ -1244,37 +1232,42 @@ void CellAndObjectIntersection::removeAllCoverage()
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+inline Int PartitionCell::getCellIndex() const
+{
+	return m_cellY * ThePartitionManager->m_cellCountX + m_cellX;
+}
+
+//-----------------------------------------------------------------------------
+inline ShroudLevel& PartitionCell::shroudLevelFor( Int playerIndex ) const
+{
+	return ThePartitionManager->m_shroudLevels[playerIndex][getCellIndex()];
+}
+
+//-----------------------------------------------------------------------------
+inline UnsignedInt& PartitionCell::threatValueFor( Int playerIndex ) const
+{
+	return ThePartitionManager->m_threatValues[playerIndex][getCellIndex()];
+}
+
+//-----------------------------------------------------------------------------
+inline UnsignedInt& PartitionCell::cashValueFor( Int playerIndex ) const
+{
+	return ThePartitionManager->m_cashValues[playerIndex][getCellIndex()];
+}
+
 //-----------------------------------------------------------------------------
 PartitionCell::PartitionCell()
 {
 	m_cellX = m_cellY = 0;
+	m_crcDirty = TRUE;
+	m_cachedCRC = 0;
 	m_firstCoiInCell = nullptr;
 	m_coiCount = 0;
 #ifdef PM_CACHE_TERRAIN_HEIGHT
 	m_loTerrainZ = HUGE_DIST;		// huge positive
 	m_hiTerrainZ = -HUGE_DIST;	// huge negative
 #endif
-	/*
-		You may be asking yourself: why do we model the shroud for all players,
-		rather than just the local player? And the answer is: because this allows
-		us to checksum these values for net games, to help prevent "shroud cheaters"
-		(who use a trainer to disable the shroud on their system).
-	*/
-	for (int i = 0; i < MAX_PLAYER_COUNT; ++i)
-	{
-		// Default is "passive shroud".  1,0.
-		m_shroudLevel[i].m_currentShroud = 1;
-#if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
-		m_shroudLevel[i].m_currentShroudJammable = 1;
-#endif
-		m_shroudLevel[i].m_activeShroudLevel = 0;
-
-		// default cash value is 0
-		m_cashValue[i] = 0;
-
-		// default threat value is 0
-		m_threatValue[i] = 0;
-	}
 }
 
 //-----------------------------------------------------------------------------
@@ -1296,7 +1289,7 @@ void PartitionCell::invalidateShroudedStatusForAllCois(Int playerIndex)
 #if PARTITIONMANAGER_QUEUE_PER_CELL
 //void PartitionCell::addUndoShroudReveal(const std::multimap<UnsignedInt, CellInfo*>::iterator& it) {
 void PartitionCell::addUndoShroudReveal(UnsignedInt cellId) {
-	undoShroudRevealIds.insert(cellId);
+	ThePartitionManager->m_undoShroudRevealIdsForCells.insert(std::make_pair(getCellIndex(), cellId));
 	/*
 	//undoShroudRevealRefs.insert(std::make_pair(it->second->id, it));
 	//undoShroudRevealRefs.clear();
@@ -1323,7 +1316,14 @@ void PartitionCell::addUndoShroudReveal(UnsignedInt cellId) {
 }
 
 void PartitionCell::removeUndoShroudReveal(UnsignedInt cellInfoId) {
-	undoShroudRevealIds.erase(cellInfoId);
+	typedef std::multimap<Int, UnsignedInt>::iterator Iterator;
+	std::pair<Iterator, Iterator> range = ThePartitionManager->m_undoShroudRevealIdsForCells.equal_range(getCellIndex());
+	for (Iterator it = range.first; it != range.second; ++it) {
+		if (it->second == cellInfoId) {
+			ThePartitionManager->m_undoShroudRevealIdsForCells.erase(it);
+			break;
+		}
+	}
 	/*
 		int x = 0;
 	for(int i = 0; i < 5; ++i) {
@@ -1345,7 +1345,7 @@ void PartitionCell::removeUndoShroudReveal(UnsignedInt cellInfoId) {
 }
 
 void PartitionCell::clearUndoShroudReveal() {
-	undoShroudRevealIds.clear();
+	ThePartitionManager->m_undoShroudRevealIdsForCells.erase(getCellIndex());
 	/*
 			return;
 	//undoShroudRevealRefs.clear();
@@ -1360,16 +1360,17 @@ void PartitionCell::clearUndoShroudReveal() {
 //-----------------------------------------------------------------------------
 void PartitionCell::addLooker(Int playerIndex)
 {
+	markCRCDirty();
 	//MODDD - rearranged to be easier to understand
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 
-	if (m_shroudLevel[playerIndex].m_currentShroud >= 0) {
+	if (shroudLevelFor(playerIndex).m_currentShroud >= 0) {
 		// This cell is shrouded (1) or fogged (0).
 		// Being looked at makes the cell completely visible with 1 looker (change to -1).
-		m_shroudLevel[playerIndex].m_currentShroud = -1;
+		shroudLevelFor(playerIndex).m_currentShroud = -1;
 	} else {
 		// The cell is already visible & looked at by at least 1 looker. Add another looker (decrement).
-		m_shroudLevel[playerIndex].m_currentShroud--;
+		shroudLevelFor(playerIndex).m_currentShroud--;
 	}
 
 	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
@@ -1377,8 +1378,8 @@ void PartitionCell::addLooker(Int playerIndex)
 //	DEBUG_LOG(( "ADD    %d, %d.  CS = %d, AS = %d for player %d.",
 //							m_cellX,
 //							m_cellY,
-//							m_shroudLevel[playerIndex].m_currentShroud,
-//							m_shroudLevel[playerIndex].m_activeShroudLevel,
+//							shroudLevelFor(playerIndex).m_currentShroud,
+//							shroudLevelFor(playerIndex).m_activeShroudLevel,
 //							playerIndex
 //							));
 
@@ -1389,16 +1390,17 @@ void PartitionCell::addLooker(Int playerIndex)
 //-----------------------------------------------------------------------------
 void PartitionCell::removeLooker(Int playerIndex)
 {
+	markCRCDirty();
 	//MODDD - rearranged to be easier to understand
-	DEBUG_ASSERTCRASH( m_shroudLevel[playerIndex].m_currentShroud < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
+	DEBUG_ASSERTCRASH( shroudLevelFor(playerIndex).m_currentShroud < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
 
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
-	m_shroudLevel[playerIndex].m_currentShroud++;
+	shroudLevelFor(playerIndex).m_currentShroud++;
 
 #if !PARTITIONMANAGER_SHROUD_NONPERSISTENT
 	// If there are no lookers, and something is actively shrouding, turn to shroud
-	if( m_shroudLevel[playerIndex].m_currentShroud == 0 && m_shroudLevel[playerIndex].m_activeShroudLevel > 0 ) {
-		m_shroudLevel[playerIndex].m_currentShroud = 1;
+	if( shroudLevelFor(playerIndex).m_currentShroud == 0 && shroudLevelFor(playerIndex).m_activeShroudLevel > 0 ) {
+		shroudLevelFor(playerIndex).m_currentShroud = 1;
 	}
 #endif
 
@@ -1408,8 +1410,8 @@ void PartitionCell::removeLooker(Int playerIndex)
 //	DEBUG_LOG(( "REMOVE %d, %d.  CS = %d, AS = %d for player %d.",
 //							m_cellX,
 //							m_cellY,
-//							m_shroudLevel[playerIndex].m_currentShroud,
-//							m_shroudLevel[playerIndex].m_activeShroudLevel,
+//							shroudLevelFor(playerIndex).m_currentShroud,
+//							shroudLevelFor(playerIndex).m_activeShroudLevel,
 //							playerIndex
 //							));
 
@@ -1420,15 +1422,16 @@ void PartitionCell::removeLooker(Int playerIndex)
 #if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
 void PartitionCell::addLookerJammable(Int playerIndex)
 {
+	markCRCDirty();
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 
-	if (m_shroudLevel[playerIndex].m_currentShroudJammable >= 0) {
+	if (shroudLevelFor(playerIndex).m_currentShroudJammable >= 0) {
 		// This cell is shrouded (1) or fogged (0).
 		// Being looked at makes the cell completely visible with 1 looker (change to -1).
-		m_shroudLevel[playerIndex].m_currentShroudJammable = -1;
+		shroudLevelFor(playerIndex).m_currentShroudJammable = -1;
 	} else {
 		// The cell is already visible & looked at by at least 1 looker. Add another looker (decrement).
-		m_shroudLevel[playerIndex].m_currentShroudJammable--;
+		shroudLevelFor(playerIndex).m_currentShroudJammable--;
 	}
 
 	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
@@ -1439,16 +1442,17 @@ void PartitionCell::addLookerJammable(Int playerIndex)
 
 void PartitionCell::removeLookerJammable(Int playerIndex)
 {
-	DEBUG_ASSERTCRASH( m_shroudLevel[playerIndex].m_currentShroudJammable < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
+	markCRCDirty();
+	DEBUG_ASSERTCRASH( shroudLevelFor(playerIndex).m_currentShroudJammable < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
 
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 
-	m_shroudLevel[playerIndex].m_currentShroudJammable++;
+	shroudLevelFor(playerIndex).m_currentShroudJammable++;
 
 #if !PARTITIONMANAGER_SHROUD_NONPERSISTENT
 	// If there are no lookers, and something is actively shrouding, turn to shroud
-	if( m_shroudLevel[playerIndex].m_currentShroudJammable == 0 && m_shroudLevel[playerIndex].m_activeShroudLevel > 0 ) {
-		m_shroudLevel[playerIndex].m_currentShroudJammable = 1;
+	if( shroudLevelFor(playerIndex).m_currentShroudJammable == 0 && shroudLevelFor(playerIndex).m_activeShroudLevel > 0 ) {
+		shroudLevelFor(playerIndex).m_currentShroudJammable = 1;
 	}
 #endif
 
@@ -1461,23 +1465,24 @@ void PartitionCell::removeLookerJammable(Int playerIndex)
 //-----------------------------------------------------------------------------
 void PartitionCell::addShrouder( Int playerIndex )
 {
+	markCRCDirty();
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 
-	Bool oldActiveShroudStatus = (m_shroudLevel[playerIndex].m_activeShroudLevel != 0);
-	m_shroudLevel[playerIndex].m_activeShroudLevel++;
-	Bool newActiveShroudStatus = (m_shroudLevel[playerIndex].m_activeShroudLevel != 0);
+	Bool oldActiveShroudStatus = (shroudLevelFor(playerIndex).m_activeShroudLevel != 0);
+	shroudLevelFor(playerIndex).m_activeShroudLevel++;
+	Bool newActiveShroudStatus = (shroudLevelFor(playerIndex).m_activeShroudLevel != 0);
 
 #if !PARTITIONMANAGER_SHROUD_NONPERSISTENT
 	// If the cell is fog-of-war, turn it to shroud
-	if( m_shroudLevel[playerIndex].m_currentShroud == 0 )
+	if( shroudLevelFor(playerIndex).m_currentShroud == 0 )
 	{
-		m_shroudLevel[playerIndex].m_currentShroud = 1;
+		shroudLevelFor(playerIndex).m_currentShroud = 1;
 	}
 	#if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
 	// Is there someone you're forgetting?
-	if( m_shroudLevel[playerIndex].m_currentShroudJammable == 0 )
+	if( shroudLevelFor(playerIndex).m_currentShroudJammable == 0 )
 	{
-		m_shroudLevel[playerIndex].m_currentShroudJammable = 1;
+		shroudLevelFor(playerIndex).m_currentShroudJammable = 1;
 	}
 	#endif
 #endif
@@ -1492,14 +1497,15 @@ void PartitionCell::addShrouder( Int playerIndex )
 //-----------------------------------------------------------------------------
 void PartitionCell::removeShrouder( Int playerIndex )
 {
+	markCRCDirty();
 	//MODDD - rearranged to be easier to understand
-	DEBUG_ASSERTCRASH( m_shroudLevel[playerIndex].m_activeShroudLevel > 0, ("'removeShrouder' called on a cell that does not have any shrouders.") );
+	DEBUG_ASSERTCRASH( shroudLevelFor(playerIndex).m_activeShroudLevel > 0, ("'removeShrouder' called on a cell that does not have any shrouders.") );
 
 	// original block for reference
 	/*
 	// Decreasing active shroud: just decrement activeLevel.  This will never result in a client change.
 	// Either it was passive shroud and is now active, or it was being looked at and still is.
-	m_shroudLevel[playerIndex].m_activeShroudLevel--;
+	shroudLevelFor(playerIndex).m_activeShroudLevel--;
 	*/
 
 	//MODDD - need to update in this case for proper behavior.
@@ -1507,9 +1513,9 @@ void PartitionCell::removeShrouder( Int playerIndex )
 	// And even outside of that mode, this lets the shroud behind moving jamming units return to fog-of-war if it was that way to begin with.
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 	
-	Bool oldActiveShroudStatus = (m_shroudLevel[playerIndex].m_activeShroudLevel != 0);
-	m_shroudLevel[playerIndex].m_activeShroudLevel--;
-	Bool newActiveShroudStatus = (m_shroudLevel[playerIndex].m_activeShroudLevel != 0);
+	Bool oldActiveShroudStatus = (shroudLevelFor(playerIndex).m_activeShroudLevel != 0);
+	shroudLevelFor(playerIndex).m_activeShroudLevel--;
+	Bool newActiveShroudStatus = (shroudLevelFor(playerIndex).m_activeShroudLevel != 0);
 
 	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
 	
@@ -1527,20 +1533,21 @@ void PartitionCell::removeShrouder( Int playerIndex )
 //-----------------------------------------------------------------------------
 void PartitionCell::setShroud( Int playerIndex )
 {
+	markCRCDirty();
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 
 	// If 0 (fog), be shroud (1) instead. If someone is actively looking (<0), this would wrongly override that.
 	// That also means cells being visibly shrouded because they're jammed will just stay shrouded even if
 	// the jammer moves, since that kind of shroud isn't from changing 'currentShroud' directly (activeShrouders
 	// at the time of currentShroud being 0).
-	if( m_shroudLevel[playerIndex].m_currentShroud == 0 )
+	if( shroudLevelFor(playerIndex).m_currentShroud == 0 )
 	{
-		m_shroudLevel[playerIndex].m_currentShroud = 1;
+		shroudLevelFor(playerIndex).m_currentShroud = 1;
 	}
 #if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
-	if( m_shroudLevel[playerIndex].m_currentShroudJammable == 0 )
+	if( shroudLevelFor(playerIndex).m_currentShroudJammable == 0 )
 	{
-		m_shroudLevel[playerIndex].m_currentShroudJammable = 1;
+		shroudLevelFor(playerIndex).m_currentShroudJammable = 1;
 	}
 #endif
 
@@ -1552,13 +1559,13 @@ void PartitionCell::setShroud( Int playerIndex )
 //MODDD
 ShroudLevel PartitionCell::getShroudLevel( Int playerIndex )
 {
-	return m_shroudLevel[playerIndex];
+	return shroudLevelFor(playerIndex);
 }
 
 #if PARTITIONMANAGER_SHROUD_NONPERSISTENT || PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS || PARTITIONMANAGER_QUEUE_PER_CELL
 Bool PartitionCell::isBeingJammed( Int playerIndex ) const
 {
-	return (m_shroudLevel[playerIndex].m_activeShroudLevel > 0);
+	return (shroudLevelFor(playerIndex).m_activeShroudLevel > 0);
 }
 #endif
 
@@ -1566,7 +1573,7 @@ Bool PartitionCell::isBeingJammed( Int playerIndex ) const
 //Bool PartitionCell::isShroudedForPlayer( Int playerIndex ) const
 //{
 	// There isn't an absolute answer.  This cell is only shrouded in regards to a person
-//	return (m_shroudLevel[playerIndex].m_currentShroud == 1);
+//	return (shroudLevelFor(playerIndex).m_currentShroud == 1);
 //}
 
 //-----------------------------------------------------------------------------
@@ -1584,7 +1591,7 @@ CellShroudStatus PartitionCell::getShroudStatusForPlayer( Int playerIndex ) cons
 		return CELLSHROUD_CLEAR;
 	*/
 
-	Short currentShroud = m_shroudLevel[playerIndex].m_currentShroud;
+	Short currentShroud = shroudLevelFor(playerIndex).m_currentShroud;
 
 // The check happening this early means the involvement of 'currentShroudJammable' will be skipped.
 // (assuming PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS is the case for that to be possible in the first place)
@@ -1616,7 +1623,7 @@ CellShroudStatus PartitionCell::getShroudStatusForPlayer( Int playerIndex ) cons
 #endif
 
 #if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
-	Short currentShroudJammable = m_shroudLevel[playerIndex].m_currentShroudJammable;
+	Short currentShroudJammable = shroudLevelFor(playerIndex).m_currentShroudJammable;
 	// If we're not being jammed and the jammable shroud value is more clear, use it instead
 	if ( currentShroudJammable < currentShroud )
 	{
@@ -1648,10 +1655,10 @@ void PartitionCell::onActiveShroudLevelChanged( Bool oldActiveShroudStatus, Bool
 	// should still use the check over there instead of in here (surrounding with #if here for safety)
 	/*
 #if !REMOVE_FOG_OF_WAR
-	if( m_shroudLevel[playerIndex].m_activeShroudLevel > 0 )
+	if( shroudLevelFor(playerIndex).m_activeShroudLevel > 0 )
 	{
-		if (m_shroudLevel[playerIndex].m_currentShroud == 0) {
-			m_shroudLevel[playerIndex].m_currentShroud = 1;
+		if (shroudLevelFor(playerIndex).m_currentShroud == 0) {
+			shroudLevelFor(playerIndex).m_currentShroud = 1;
 		}
 	}
 	// if you really want to re-enable this here, don't forget the '#if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS' -> '...m_currentShroudJammable = 1' bit
@@ -1668,9 +1675,10 @@ void PartitionCell::onActiveShroudLevelChanged( Bool oldActiveShroudStatus, Bool
 
 	if (oldActiveShroudStatus) {
 		// Changed from actively shrouded to passively shrouded
-		std::set<UnsignedInt>::iterator it;
-		for (it = undoShroudRevealIds.begin(); it != undoShroudRevealIds.end(); ++it) {
-			CellInfo* cellInfo = ThePartitionManager->getCellInfo(*it);
+		std::multimap<Int, UnsignedInt>::iterator it;
+		std::multimap<Int, UnsignedInt>::iterator end = ThePartitionManager->m_undoShroudRevealIdsForCells.upper_bound(getCellIndex());
+		for (it = ThePartitionManager->m_undoShroudRevealIdsForCells.lower_bound(getCellIndex()); it != end; ++it) {
+			CellInfo* cellInfo = ThePartitionManager->getCellInfo(it->second);
 			// If the goal time was set for jamming (20%), take that amount out & replace with 100%
 			if (cellInfo->m_goalTimeAdjustedForJamming) {
 				ThePartitionManager->removePendingUndoShroudRevealForCell(cellInfo);
@@ -1681,9 +1689,10 @@ void PartitionCell::onActiveShroudLevelChanged( Bool oldActiveShroudStatus, Bool
 		}
 	} else {
 		// Changed from passively shrouded to actively shrouded
-		std::set<UnsignedInt>::iterator it;
-		for (it = undoShroudRevealIds.begin(); it != undoShroudRevealIds.end(); ++it) {
-			CellInfo* cellInfo = ThePartitionManager->getCellInfo(*it);
+		std::multimap<Int, UnsignedInt>::iterator it;
+		std::multimap<Int, UnsignedInt>::iterator end = ThePartitionManager->m_undoShroudRevealIdsForCells.upper_bound(getCellIndex());
+		for (it = ThePartitionManager->m_undoShroudRevealIdsForCells.lower_bound(getCellIndex()); it != end; ++it) {
+			CellInfo* cellInfo = ThePartitionManager->getCellInfo(it->second);
 			// If the goal time was set for passive (100%), take that amount out & replace with 20%
 			if (!cellInfo->m_goalTimeAdjustedForJamming) {
 				ThePartitionManager->removePendingUndoShroudRevealForCell(cellInfo);
@@ -1717,7 +1726,7 @@ void PartitionCell::onCellShroudStatusChanged( CellShroudStatus oldShroud, CellS
 UnsignedInt PartitionCell::getThreatValue( Int playerIndex )
 {
 	if (playerIndex >= 0 && playerIndex < MAX_PLAYER_COUNT) {
-		return m_threatValue[playerIndex];
+		return threatValueFor(playerIndex);
 	}
 	return 0;
 }
@@ -1727,10 +1736,10 @@ void PartitionCell::addThreatValue( Int playerIndex, UnsignedInt threatValue )
 {
 	if (playerIndex >= 0 && playerIndex < MAX_PLAYER_COUNT) {
 #ifdef DEBUG_CRASHING
-		UnsignedInt oldThreatVal = m_threatValue[playerIndex];
+		UnsignedInt oldThreatVal = threatValueFor(playerIndex);
 		DEBUG_ASSERTCRASH(oldThreatVal <= oldThreatVal + threatValue, ("adding new threat value overflowed allotted storage."));
 #endif
-		m_threatValue[playerIndex] += threatValue;
+		threatValueFor(playerIndex) += threatValue;
 	}
 }
 
@@ -1739,10 +1748,10 @@ void PartitionCell::removeThreatValue( Int playerIndex, UnsignedInt threatValue
 {
 	if (playerIndex >= 0 && playerIndex < MAX_PLAYER_COUNT) {
 #ifdef DEBUG_CRASHING
-		UnsignedInt oldThreatVal = m_threatValue[playerIndex];
+		UnsignedInt oldThreatVal = threatValueFor(playerIndex);
 		DEBUG_ASSERTCRASH(oldThreatVal >= oldThreatVal - threatValue, ("removing new threat value underflowed allotted storage."));
 #endif
-		m_threatValue[playerIndex] -= threatValue;
+		threatValueFor(playerIndex) -= threatValue;
 	}
 }
 
@@ -1750,7 +1759,7 @@ void PartitionCell::removeThreatValue( Int playerIndex, UnsignedInt threatValue
 UnsignedInt PartitionCell::getCashValue( Int playerIndex )
 {
 	if (playerIndex >= 0 && playerIndex < MAX_PLAYER_COUNT) {
-		return m_cashValue[playerIndex];
+		return cashValueFor(playerIndex);
 	}
 	return 0;
 }
@@ -1760,10 +1769,10 @@ void PartitionCell::addCashValue( Int playerIndex, UnsignedInt cashValue )
 {
 	if (playerIndex >= 0 && playerIndex < MAX_PLAYER_COUNT) {
 #ifdef DEBUG_CRASHING
-		UnsignedInt oldCashVal = m_cashValue[playerIndex];
+		UnsignedInt oldCashVal = cashValueFor(playerIndex);
 		DEBUG_ASSERTCRASH(oldCashVal <= oldCashVal + cashValue, ("adding new cash value overflowed allotted storage."));
 #endif
-		m_cashValue[playerIndex] += cashValue;
+		cashValueFor(playerIndex) += cashValue;
 	}
 }
 
@@ -1772,10 +1781,10 @@ void PartitionCell::removeCashValue( Int playerIndex, UnsignedInt cashValue )
 {
 	if (playerIndex >= 0 && playerIndex < MAX_PLAYER_COUNT) {
 #ifdef DEBUG_CRASHING
-		UnsignedInt oldCashVal = m_cashValue[playerIndex];
+		UnsignedInt oldCashVal = cashValueFor(playerIndex);
 		DEBUG_ASSERTCRASH(oldCashVal >= oldCashVal - cashValue, ("removing new cash value underflowed allotted storage."));
 #endif
-		m_cashValue[playerIndex] -= cashValue;
+		cashValueFor(playerIndex) -= cashValue;
 	}
 }
 
@@ -1826,8 +1835,11 @@ void PartitionCell::validateCoiList()
 // ------------------------------------------------------------------------------------------------
 void PartitionCell::crc( Xfer *xfer )
 {
+	ShroudLevel shroudLevels[MAX_PLAYER_COUNT];
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+		shroudLevels[i] = shroudLevelFor(i);
 
-	xfer->xferUser(&m_shroudLevel, sizeof(ShroudLevel) * MAX_PLAYER_COUNT);
+	xfer->xferUser(shroudLevels, sizeof(ShroudLevel) * MAX_PLAYER_COUNT);
 	xfer->xferUser(&m_cellX, sizeof(m_cellX));
 	xfer->xferUser(&m_cellY, sizeof(m_cellY));
 
@@ -1838,6 +1850,7 @@ void PartitionCell::crc( Xfer *xfer )
 // ------------------------------------------------------------------------------------------------
 void PartitionCell::xfer( Xfer *xfer )
 {
+	markCRCDirty();
 
 	// version
 	XferVersion currentVersion = 1;
@@ -1845,7 +1858,17 @@ void PartitionCell::xfer( Xfer *xfer )
 	xfer->xferVersion( &version, currentVersion );
 
 	// xfer shroud data
-	xfer->xferUser( &m_shroudLevel, sizeof( ShroudLevel ) * MAX_PLAYER_COUNT );
+	ShroudLevel shroudLevels[MAX_PLAYER_COUNT];
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+		shroudLevels[i] = shroudLevelFor(i);
+
+	xfer->xferUser( shroudLevels, sizeof( ShroudLevel ) * MAX_PLAYER_COUNT );
+
+	if( xfer->getXferMode() == XFER_LOAD )
+	{
+		for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+			shroudLevelFor(i) = shroudLevels[i];
+	}
 
 }
 
@@ -2743,25 +2766,21 @@ void PartitionData::detachFromGhostObject()
 }
 
 //-----------------------------------------------------------------------------
-inline UnsignedInt hash2ints(Int a, Int b)
+inline UnsignedInt64 contactKey(ObjectID a, ObjectID b)
 {
-	// do it this way so that [a,b] always hashes to the same value as [b,a].
-	// this is unsophisticated but reasonable, since all ObjectIDs will
-	// quite likely be well below 65536...
+	// [a,b] and [b,a] are the same contact. Object IDs are never 0, so neither is the key.
 	if (a < b)
-	{
-		return (a<<16)+b;
-	}
+		return ((UnsignedInt64)a << 32) | (UnsignedInt64)b;
 	else
-	{
-		return (b<<16)+a;
-	}
+		return ((UnsignedInt64)b << 32) | (UnsignedInt64)a;
 }
 
-
-//-----------------------------------------------------------------------------
-//-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
+inline UnsignedInt contactHash(UnsignedInt64 key)
+{
+	UnsignedInt hash = (UnsignedInt)key * 0x9E3779B1u ^ (UnsignedInt)(key >> 32) * 0x85EBCA77u;
+	return hash ^ (hash >> 15);
+}
 
 //-----------------------------------------------------------------------------
 void PartitionContactList::addToContactList( PartitionData *obj, PartitionData *other )
@@ -2774,93 +2793,64 @@ void PartitionContactList::addToContactList( PartitionData *obj, PartitionData *
 	if (obj_obj == nullptr || other_obj == nullptr)
 		return;
 
-	// compute hash index based on object's ids.
-	UnsignedInt hashValue = hash2ints(obj_obj->getID(), other_obj->getID());
-	hashValue %= PartitionContactList_SOCKET_COUNT;
+	// keep the table at most half full
+	if ((m_contacts.size() + 1) * 2 > m_slots.size())
+		growSlots();
 
 	// make sure given hit has not already been recorded
-	for (PartitionContactListNode* cd = m_contactHash[ hashValue ]; cd; cd = cd->m_nextHash )
+	const UnsignedInt64 key = contactKey(obj_obj->getID(), other_obj->getID());
+	const UnsignedInt mask = (UnsignedInt)m_slots.size() - 1;
+	UnsignedInt slot = contactHash(key) & mask;
+	while (m_slots[slot] != 0)
 	{
-		if ((cd->m_obj == obj && cd->m_other == other) ||
-				(cd->m_obj == other && cd->m_other == obj))
+		if (m_slots[slot] == key)
 		{
 			// already noted
 			return;
 		}
+		slot = (slot + 1) & mask;
 	}
 
 	// new hit
-	PartitionContactListNode *ncd = newInstance(PartitionContactListNode);
-	ncd->m_obj = obj;
-	ncd->m_other = other;
-	ncd->m_hashValue = hashValue;
-
-	// add to hash table
-	ncd->m_nextHash = m_contactHash[ hashValue ];
-	m_contactHash[ hashValue ] = ncd;
-
-	// add to list of contacts for this frame
-	ncd->m_next = m_contactList;
-	m_contactList = ncd;
-
+	m_slots[slot] = key;
 
-#if 0
-
-Int depth = 0;
-for (PartitionContactListNode *cd2 = m_contactHash[ hashValue ]; cd2; cd2 = cd2->m_nextHash )
-{
-	depth++;
+	Contact contact;
+	contact.m_obj = obj;
+	contact.m_other = other;
+	contact.m_slot = slot;
+	m_contacts.push_back(contact);
 }
-if (depth > 3)
-{
-	DEBUG_LOG(("depth is %d for %s %08lx (%d) - %s %08lx (%d)",
-		depth,obj_obj->getTemplate()->getName().str(),obj_obj,obj_obj->getID(),
-		other_obj->getTemplate()->getName().str(),other_obj,other_obj->getID()
-		));
 
-	for (cd2 = m_contactHash[ hashValue ]; cd2; cd2 = cd2->m_nextHash )
-	{
-		UnsignedInt rawhash = djb2hash2ints(cd2->m_obj->getObject()->getID(), cd2->m_other->getObject()->getID());
-		//hashValue %= PartitionContactList_SOCKET_COUNT;
-
-
-		DEBUG_LOG(("ENTRY: %s %08lx (%d) - %s %08lx (%d) [rawhash %d]",
-			cd2->m_obj->getObject()->getTemplate()->getName().str(),cd2->m_obj->getObject(),cd2->m_obj->getObject()->getID(),
-			cd2->m_other->getObject()->getTemplate()->getName().str(),cd2->m_other->getObject(),cd2->m_other->getObject()->getID(),
-			rawhash));
-	}
-}
-
-static Real aggtotal = 0;
-static Real aggfull = 0;
-static Real aggcount = 0;
-for (int ii = 0; ii < PartitionContactList_SOCKET_COUNT; ++ii)
+//-----------------------------------------------------------------------------
+void PartitionContactList::growSlots()
 {
-	if (m_contactHash[ii])
-		aggfull += 1.0f;
+	std::vector<UnsignedInt64> slots(m_slots.size() * 2, 0);
+	const UnsignedInt mask = (UnsignedInt)slots.size() - 1;
 
-	for (cd2 = m_contactHash[ ii ]; cd2; cd2 = cd2->m_nextHash )
+	for (size_t i = 0; i < m_contacts.size(); ++i)
 	{
-		aggtotal += 1.0f;
+		Contact& contact = m_contacts[i];
+		const UnsignedInt64 key = m_slots[contact.m_slot];
+		UnsignedInt slot = contactHash(key) & mask;
+		while (slots[slot] != 0)
+			slot = (slot + 1) & mask;
+		slots[slot] = key;
+		contact.m_slot = slot;
 	}
-}
-aggcount += 1.0f;
-DEBUG_ASSERTLOG(((Int)aggcount)%1000!=0,("avg hash depth at %f is %f, fullness %f%%",
-aggcount,aggtotal/(aggcount*PartitionContactList_SOCKET_COUNT),(aggfull*100)/(aggcount*PartitionContactList_SOCKET_COUNT)));
-#endif
-
 
+	m_slots.swap(slots);
 }
 
 //-----------------------------------------------------------------------------
 void PartitionContactList::removeSpecificPartitionData(PartitionData* data)
 {
-	for (PartitionContactListNode* cd = m_contactList; cd; cd = cd->m_next)
+	for (size_t i = 0; i < m_contacts.size(); ++i)
 	{
-		if (cd->m_obj == data || cd->m_other == data)
+		Contact& contact = m_contacts[i];
+		if (contact.m_obj == data || contact.m_other == data)
 		{
-			cd->m_obj = nullptr;
-			cd->m_other = nullptr;
+			contact.m_obj = nullptr;
+			contact.m_other = nullptr;
 		}
 	}
 }
@@ -2868,23 +2858,20 @@ void PartitionContactList::removeSpecificPartitionData(PartitionData* data)
 //-----------------------------------------------------------------------------
 void PartitionContactList::resetContactList()
 {
-	// remove items from hash table
-	PartitionContactListNode* cdnext;
-	for (PartitionContactListNode* cd = m_contactList; cd; cd = cdnext)
+	// only clear the used slots, the table can be much larger than this frame's contacts
+	for (size_t i = 0; i < m_contacts.size(); ++i)
 	{
-		cdnext = cd->m_next;
-		deleteInstance(cd);
+		m_slots[m_contacts[i].m_slot] = 0;
 	}
-
-	memset(m_contactHash, 0, sizeof(m_contactHash));
-	m_contactList = nullptr;
+	m_contacts.clear();
 }
 
 //-----------------------------------------------------------------------------
 void PartitionContactList::processContactList()
 {
-	for (PartitionContactListNode* cd = m_contactList; cd; cd = cd->m_next)
+	for (size_t i = m_contacts.size(); i > 0; --i)
 	{
+		Contact* cd = &m_contacts[i - 1];
 		if (cd->m_obj == nullptr || cd->m_other == nullptr)
 			continue;
 
@@ -2954,9 +2941,16 @@ PartitionManager::PartitionManager()
 	m_cellCountY = 0;
 	m_totalCellCount = 0;
 	m_cells = nullptr;
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+	{
+		m_shroudLevels[i] = nullptr;
+		m_threatValues[i] = nullptr;
+		m_cashValues[i] = nullptr;
+	}
 	m_worldExtents.lo.zero();
 	m_worldExtents.hi.zero();
 	m_dirtyModules = nullptr;
+	m_contactList = NEW PartitionContactList;
 	m_updatedSinceLastReset = false;
 #ifdef FASTER_GCO
 	m_maxGcoRadius = 0;
@@ -2969,6 +2963,8 @@ PartitionManager::~PartitionManager()
 
 	shutdown();
 
+	delete m_contactList;
+
 }
 
 //-----------------------------------------------------------------------------
@@ -3035,6 +3031,33 @@ void PartitionManager::init()
 			}
 		}
 
+		/*
+			You may be asking yourself: why do we model the shroud for all players,
+			rather than just the local player? And the answer is: because this allows
+			us to checksum these values for net games, to help prevent "shroud cheaters"
+			(who use a trainer to disable the shroud on their system).
+		*/
+		for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+		{
+			m_shroudLevels[i] = MSGNEW("PartitionManager_Cells") ShroudLevel[m_totalCellCount];
+			m_threatValues[i] = MSGNEW("PartitionManager_Cells") UnsignedInt[m_totalCellCount];
+			m_cashValues[i] = MSGNEW("PartitionManager_Cells") UnsignedInt[m_totalCellCount];
+
+			for (Int cellIndex = 0; cellIndex < m_totalCellCount; ++cellIndex)
+			{
+				// Default is "passive shroud".  1,0.
+				m_shroudLevels[i][cellIndex].m_currentShroud = 1;
+#if PARTITIONMANAGER_ADVANCED_SHROUD_MECHANICS
+				m_shroudLevels[i][cellIndex].m_currentShroudJammable = 1;
+#endif
+				m_shroudLevels[i][cellIndex].m_activeShroudLevel = 0;
+			}
+
+			// default threat and cash values are 0
+			memset(m_threatValues[i], 0, m_totalCellCount * sizeof(UnsignedInt));
+			memset(m_cashValues[i], 0, m_totalCellCount * sizeof(UnsignedInt));
+		}
+
 #ifdef FASTER_GCO
 		calcRadiusVec();
 #endif
@@ -3110,6 +3133,16 @@ void PartitionManager::shutdown()
 	delete [] m_cells;
 	m_cells = nullptr;
 
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+	{
+		delete [] m_shroudLevels[i];
+		m_shroudLevels[i] = nullptr;
+		delete [] m_threatValues[i];
+		m_threatValues[i] = nullptr;
+		delete [] m_cashValues[i];
+		m_cashValues[i] = nullptr;
+	}
+
 	m_cellSize = m_cellSizeInv = 0.0f;
 	m_cellCountX = 0;
 	m_cellCountY = 0;
@@ -3132,7 +3165,7 @@ void PartitionManager::update()
 			m_updatedSinceLastReset = true;
 		}
 
-		PartitionContactList ctList;
+		PartitionContactList& ctList = *m_contactList;
 		TheContactList = &ctList;
 		while (m_dirtyModules)
 		{
@@ -3165,6 +3198,7 @@ void PartitionManager::update()
 		}
 
 		ctList.processContactList();
+		ctList.resetContactList();
 #ifdef INTENSE_DEBUG
 		DEBUG_ASSERTLOG(cc==0,("updated partition info for %d objects",cc));
 #endif
@@ -3639,6 +3673,11 @@ void PartitionManager::calcRadiusVec()
 }
 #endif
 
+//-----------------------------------------------------------------------------
+// since an object can exist in multiple COIs, getClosestObjects and friend_mergeQueryCandidates use this
+// to avoid processing the same one more than once.
+static Int theIterFlag = 1;	// nonzero, thanks
+
 //-----------------------------------------------------------------------------
 //DECLARE_PERF_TIMER(getClosestObjects)
 Object *PartitionManager::getClosestObjects(
@@ -3723,7 +3762,6 @@ Object *PartitionManager::getClosestObjects(
 
 	Bool foundAny = false;
 
-	static Int theIterFlag = 1;	// nonzero, thanks
 	++theIterFlag;
 
 	/*
@@ -3806,7 +3844,6 @@ Object *PartitionManager::getClosestObjects(
 
 	Bool foundAny = false;
 
-	static Int theIterFlag = 1;	// nonzero, thanks
 	++theIterFlag;
 
 	PartitionCell *thisCell;
@@ -3917,6 +3954,126 @@ Object *PartitionManager::getClosestObject(
 	return getClosestObjects(nullptr, pos, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
 }
 
+#ifdef FASTER_GCO
+//-----------------------------------------------------------------------------
+/**
+	Collects all objects of the cells within the query range in the same order as getClosestObjects
+	visits them, together with their distance. This runs on the worker threads, so it must only read
+	the partition data. Objects in multiple cells are collected multiple times, because the done flag
+	can not be written from here. An object that is out of range in one cell is out of range in all.
+*/
+void PartitionManager::friend_gatherQueryCandidates(const PartitionQuery& query, QueryCandidateVec& candidates)
+{
+	candidates.clear();
+
+	DistCalcProc distProc = theDistCalcProcs[query.dc];
+
+	const Coord3D *objPos = query.pos ? query.pos : query.obj->getPosition();
+	const Object *objToUse = query.pos ? nullptr : query.obj;
+
+	Int cellCenterX, cellCenterY;
+	worldToCell(objPos->x, objPos->y, &cellCenterX, &cellCenterY);
+
+	const Real maxDistSqr = query.maxDist * query.maxDist;
+
+	Int maxRadius = m_maxGcoRadius;
+	if (query.maxDist < HUGE_DIST)
+	{
+		maxRadius = minInt(m_maxGcoRadius, worldToCellDist(query.maxDist));
+	}
+
+	for (Int curRadius = 0; curRadius <= maxRadius; ++curRadius)
+	{
+		const OffsetVec& offsets = m_radiusVec[curRadius];
+		for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
+		{
+			PartitionCell* thisCell = getCellAt(cellCenterX + it->x, cellCenterY + it->y);
+			if (thisCell == nullptr)
+				continue;
+
+			for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
+			{
+				PartitionData *thisMod = thisCoi->getModule();
+				Object *thisObj = thisMod->getObject();
+
+				if (thisObj == query.obj || thisObj == nullptr)
+					continue;
+
+				QueryCandidate candidate;
+				if (!(*distProc)(objPos, objToUse, thisObj->getPosition(), thisObj, candidate.distSqr, candidate.distVec, maxDistSqr))
+					continue;
+
+				candidate.module = thisMod;
+				candidate.radius = curRadius;
+				candidates.push_back(candidate);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+/**
+	Applies the rules of getClosestObjects to the gathered candidates: skips repeated objects, shrinks
+	the search distance and radius once something was found and calls the filters in the same order.
+*/
+void PartitionManager::friend_mergeQueryCandidates(PartitionQuery& query, const QueryCandidateVec& candidates)
+{
+	Object* closestObj = nullptr;
+	Real closestDistSqr = query.maxDist * query.maxDist;
+	Coord3D closestVec;
+#if !RETAIL_COMPATIBLE_CRC // TheSuperHackers @info This should be safe to initialize because it is unused, but let us be extra safe for now.
+	closestVec.x = query.maxDist;
+	closestVec.y = query.maxDist;
+	closestVec.z = query.maxDist;
+#endif
+
+	Int maxRadiusLimit = m_maxGcoRadius;
+	Bool foundAny = false;
+
+	++theIterFlag;
+
+	for (QueryCandidateVec::const_iterator it = candidates.begin(); it != candidates.end(); ++it)
+	{
+		if (it->radius > maxRadiusLimit)
+			break;
+
+		PartitionData *thisMod = it->module;
+		if (thisMod->friend_getDoneFlag() == theIterFlag)
+			continue;
+		thisMod->friend_setDoneFlag(theIterFlag);
+
+		if (!(it->distSqr < closestDistSqr))
+			continue;
+
+		Object *thisObj = thisMod->getObject();
+		if (!filtersAllow(query.filters, thisObj))
+			continue;
+
+		if (query.iter)
+		{
+			query.iter->insert(thisObj, it->distSqr);
+		}
+		else
+		{
+			closestObj = thisObj;
+			closestDistSqr = it->distSqr;
+			closestVec = it->distVec;
+
+			if (!foundAny)
+			{
+				maxRadiusLimit = it->radius;
+			}
+			foundAny = true;
+		}
+	}
+
+	query.closestObj = closestObj;
+	query.closestDist = (Real)sqrtf(closestDistSqr);
+	query.closestVec = closestVec;
+}
+#endif // FASTER_GCO
+
+
 //-----------------------------------------------------------------------------
 void PartitionManager::getVectorTo(const Object *obj, const Object *otherObj, DistanceCalculationType dc, Coord3D& vec)
 {
@@ -4560,10 +4717,7 @@ void PartitionManager::resetPendingUndoShroudRevealQueue()
 	}
 
 	//MODDD - also clear each cell's 'undo-shroud-reveal' list
-	for (int i = 0; i < m_totalCellCount; ++i)
-	{
-		m_cells[i].clearUndoShroudReveal();
-	}
+	m_undoShroudRevealIdsForCells.clear();
 	m_cellInfos.clear();
 #endif
 }
@@ -5295,6 +5449,36 @@ void PartitionManager::crc( Xfer *xfer )
 
 }
 
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance 18/10/2026 CRC of the cached CRC of each cell. Only the cells
+	* that changed since the last call are run through their crc method again. */
+// ------------------------------------------------------------------------------------------------
+void PartitionManager::crcIncremental( Xfer *xfer )
+{
+
+	for (Int i=0; i<m_totalCellCount; ++i)
+	{
+		PartitionCell *cell = &m_cells[i];
+		if (cell->isCRCDirty())
+		{
+			cell->setCachedCRC(XferCRC::calcSnapshotCRC(cell));
+		}
+#ifdef RTS_DEBUG
+		else
+		{
+			const UnsignedInt fullCRC = XferCRC::calcSnapshotCRC(cell);
+			DEBUG_ASSERTCRASH(fullCRC == cell->getCachedCRC(), ("Partition cell %d,%d changed without markCRCDirty",
+				cell->getCellX(), cell->getCellY()));
+			cell->setCachedCRC(fullCRC);
+		}
+#endif
+
+		UnsignedInt cellCRC = cell->getCachedCRC();
+		xfer->xferUnsignedInt(&cellCRC);
+	}
+
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Xfer Method
 	* Version Info:
@@ -6403,12 +6587,21 @@ void hLineAddLooker(Int x1, Int x2, Int y, void *playerIndexVoid)
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
+	// TheSuperHackers @performance 18/10/2026 Walk the clipped span along the contiguous row of the shroud grid.
+	// A cell that is already looked at stays clear, so only the first looker needs the full update.
+	x1 = max(x1, 0);
+	x2 = min(x2, ThePartitionManager->m_cellCountX - 1);
+
+	const Int firstCellIndex = y * ThePartitionManager->m_cellCountX + x1;
+	ShroudLevel* shroud = &ThePartitionManager->m_shroudLevels[playerIndex][firstCellIndex];
+	PartitionCell* cell = &ThePartitionManager->m_cells[firstCellIndex];
+	for (Int x = x1; x <= x2; ++x, ++shroud, ++cell)
 	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->addLooker(playerIndex);
+		cell->markCRCDirty();
+		if (shroud->m_currentShroud < 0)
+			--shroud->m_currentShroud;
+		else
+			cell->addLooker(playerIndex);
 	}
 }
 
@@ -6420,14 +6613,22 @@ void hLineRemoveLooker(Int x1, Int x2, Int y, void *playerIndexVoid)
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
+	// TheSuperHackers @performance 18/10/2026 Walk the clipped span along the contiguous row of the shroud grid.
+	// A cell that keeps at least one looker stays clear, so only the last looker needs the full update.
+	x1 = max(x1, 0);
+	x2 = min(x2, ThePartitionManager->m_cellCountX - 1);
 
+	const Int firstCellIndex = y * ThePartitionManager->m_cellCountX + x1;
+	ShroudLevel* shroud = &ThePartitionManager->m_shroudLevels[playerIndex][firstCellIndex];
+	PartitionCell* cell = &ThePartitionManager->m_cells[firstCellIndex];
+	for (Int x = x1; x <= x2; ++x, ++shroud, ++cell)
+	{
 #if !PARTITIONMANAGER_QUEUE_PER_CELL
-		cell->removeLooker(playerIndex);
+		cell->markCRCDirty();
+		if (shroud->m_currentShroud < -1)
+			++shroud->m_currentShroud;
+		else
+			cell->removeLooker(playerIndex);
 #else
 		// Add the cell to the unlook queue instead
 		std::multimap<UnsignedInt, UnsignedInt>::iterator it = ThePartitionManager->queueUndoShroudRevealCell(x, y, playerIndex, cell->isBeingJammed(playerIndex));
@@ -6536,15 +6737,19 @@ void hLineAddThreat(Int x1, Int x2, Int y, void *threatValueParms)
 
 	ThreatValueParms *parms = (ThreatValueParms*)threatValueParms;
 
+	if (parms->playerIndex < 0 || parms->playerIndex >= MAX_PLAYER_COUNT)
+		return;
+
 	Real distance;
 	Real mulVal = 1.0f;
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
+	// TheSuperHackers @performance 18/10/2026 Walk the clipped span along the contiguous row of the threat grid.
+	x1 = max(x1, 0);
+	x2 = min(x2, ThePartitionManager->m_cellCountX - 1);
 
+	UnsignedInt* value = &ThePartitionManager->m_threatValues[parms->playerIndex][y * ThePartitionManager->m_cellCountX + x1];
+	for (Int x = x1; x <= x2; ++x, ++value)
+	{
 		distance = sqrt( pow(x - parms->xCenter, 2) + pow(y - parms->yCenter, 2) );
 		mulVal = 1 - distance / parms->radius;
 		if (mulVal < 0.0f)
@@ -6552,7 +6757,7 @@ void hLineAddThreat(Int x1, Int x2, Int y, void *threatValueParms)
 		else if (mulVal > 1.0f)
 			mulVal = 1.0f;
 
-		cell->addThreatValue( parms->playerIndex, REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal) );
+		*value += REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal);
 	}
 }
 
@@ -6564,15 +6769,19 @@ void hLineRemoveThreat(Int x1, Int x2, Int y, void *threatValueParms)
 
 	ThreatValueParms *parms = (ThreatValueParms*)threatValueParms;
 
+	if (parms->playerIndex < 0 || parms->playerIndex >= MAX_PLAYER_COUNT)
+		return;
+
 	Real distance;
 	Real mulVal = 1.0f;
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
+	// TheSuperHackers @performance 18/10/2026 Walk the clipped span along the contiguous row of the threat grid.
+	x1 = max(x1, 0);
+	x2 = min(x2, ThePartitionManager->m_cellCountX - 1);
 
+	UnsignedInt* value = &ThePartitionManager->m_threatValues[parms->playerIndex][y * ThePartitionManager->m_cellCountX + x1];
+	for (Int x = x1; x <= x2; ++x, ++value)
+	{
 		distance = sqrt( pow(x - parms->xCenter, 2) + pow(y - parms->yCenter, 2) );
 		mulVal = 1 - distance / parms->radius;
 		if (mulVal < 0.0f)
@@ -6580,7 +6789,7 @@ void hLineRemoveThreat(Int x1, Int x2, Int y, void *threatValueParms)
 		else if (mulVal > 1.0f)
 			mulVal = 1.0f;
 
-		cell->removeThreatValue( parms->playerIndex, REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal) );
+		*value -= REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal);
 	}
 }
 
@@ -6592,15 +6801,19 @@ void hLineAddValue(Int x1, Int x2, Int y, void *threatValueParms)
 
 	ThreatValueParms *parms = (ThreatValueParms*)threatValueParms;
 
+	if (parms->playerIndex < 0 || parms->playerIndex >= MAX_PLAYER_COUNT)
+		return;
+
 	Real distance;
 	Real mulVal = 1.0f;
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
+	// TheSuperHackers @performance 18/10/2026 Walk the clipped span along the contiguous row of the cash grid.
+	x1 = max(x1, 0);
+	x2 = min(x2, ThePartitionManager->m_cellCountX - 1);
 
+	UnsignedInt* value = &ThePartitionManager->m_cashValues[parms->playerIndex][y * ThePartitionManager->m_cellCountX + x1];
+	for (Int x = x1; x <= x2; ++x, ++value)
+	{
 		distance = sqrt( pow(x - parms->xCenter, 2) + pow(y - parms->yCenter, 2) );
 		mulVal = 1 - distance / parms->radius;
 		if (mulVal < 0.0f)
@@ -6608,7 +6821,7 @@ void hLineAddValue(Int x1, Int x2, Int y, void *threatValueParms)
 		else if (mulVal > 1.0f)
 			mulVal = 1.0f;
 
-		cell->addCashValue( parms->playerIndex, REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal) );
+		*value += REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal);
 	}
 }
 
@@ -6620,15 +6833,19 @@ void hLineRemoveValue(Int x1, Int x2, Int y, void *threatValueParms)
 
 	ThreatValueParms *parms = (ThreatValueParms*)threatValueParms;
 
+	if (parms->playerIndex < 0 || parms->playerIndex >= MAX_PLAYER_COUNT)
+		return;
+
 	Real distance;
 	Real mulVal = 1.0f;
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
+	// TheSuperHackers @performance 18/10/2026 Walk the clipped span along the contiguous row of the cash grid.
+	x1 = max(x1, 0);
+	x2 = min(x2, ThePartitionManager->m_cellCountX - 1);
 
+	UnsignedInt* value = &ThePartitionManager->m_cashValues[parms->playerIndex][y * ThePartitionManager->m_cellCountX + x1];
+	for (Int x = x1; x <= x2; ++x, ++value)
+	{
 		distance = sqrt( pow(x - parms->xCenter, 2) + pow(y - parms->yCenter, 2) );
 		mulVal = 1 - distance / parms->radius;
 		if (mulVal < 0.0f)
@@ -6636,7 +6853,7 @@ void hLineRemoveValue(Int x1, Int x2, Int y, void *threatValueParms)
 		else if (mulVal > 1.0f)
 			mulVal = 1.0f;
 
-		cell->removeCashValue( parms->playerIndex, REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal) );
+		*value -= REAL_TO_UNSIGNEDINT(parms->threatOrValue * mulVal);
 	}
 }
 
@@ -6644,6 +6861,7 @@ void hLineRemoveValue(Int x1, Int x2, Int y, void *threatValueParms)
 // ------------------------------------------------------------------------------------------------
 SightingInfo::SightingInfo()
 {
+	m_nextInQueue = nullptr;
 	reset();
 }
 
@@ -1641,6 +1641,7 @@ public:
 			if (w == nullptr)
 				continue;
 
+			jet->markCRCDirty();
 			if (now >= m_reloadDoneFrame)
 				w->setClipPercentFull(1.0f, false);
 			else
@@ -2138,6 +2138,7 @@ void Weapon::rebuildScatterTargets()
 //-------------------------------------------------------------------------------------------------
 void Weapon::reloadWithBonus(const Object *sourceObj, const WeaponBonus& bonus, Bool loadInstantly)
 {
+	sourceObj->markCRCDirty();
 	if (m_template->getClipSize() > 0
 			&& m_ammoInClip == m_template->getClipSize()
 			&& !sourceObj->isReloadTimeShared())
@@ -2196,6 +2197,7 @@ static void clipToTerrainExtent(Coord3D& approachTargetPos)
 //-------------------------------------------------------------------------------------------------
 void Weapon::onWeaponBonusChange(const Object *source)
 {
+	source->markCRCDirty();
 	// We are concerned with our reload times being off if our ROF just changed.
 
 	WeaponBonus bonus;
@@ -2649,6 +2651,7 @@ Real Weapon::estimateWeaponDamage(const Object *sourceObj, const Object *victimO
 //-------------------------------------------------------------------------------------------------
 void Weapon::newProjectileFired(const Object *sourceObj, const Object *projectile, const Object *victimObj, const Coord3D *victimPos )
 {
+	sourceObj->markCRCDirty();
 	/*
 	if(sourceObj && sourceObj->getTemplate()->getName().compare("ChinaInfantryJumpjetTrooper") == 0){
 		std::ofstream outputFile;
@@ -2742,6 +2745,7 @@ Bool Weapon::privateFireWeapon(
 	Bool inflictDamage
 )
 {
+	sourceObj->markCRCDirty();
 	//MODDD - bugfix for a weapon deleting itself in 'fireWeapon'.
 	// Reset 'queuedOcl' in advance so this method somehow failing to set it doesn't leave a leftover value
 	// from some unrelated call to be run again. The caller should handle setting this back to null & ideally
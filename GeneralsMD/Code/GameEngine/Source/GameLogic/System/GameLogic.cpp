@@ -41,6 +41,7 @@
 #include "Common/GameUtility.h"
 #include "Common/INI.h"
 #include "Common/LatchRestore.h"
+#include "Common/LogicFrameProfile.h"
 #include "Common/MapObject.h"
 #include "Common/MultiplayerSettings.h"
 #include "Common/OSDisplay.h"
@@ -97,6 +98,7 @@
 #include "GameLogic/ScriptConditions.h"
 #include "GameLogic/ScriptEngine.h"
 #include "GameLogic/SidesList.h"
+#include "GameLogic/UpdateModuleProfile.h"
 #include "GameLogic/VictoryConditions.h"
 #include "GameLogic/Weapon.h"
 #include "GameLogic/GhostObject.h"
@@ -315,9 +317,9 @@ GameLogic::GameLogic()
 
 void GameLogic::resetUpdateModuleQueues() {
 	// blow away the sleepy update and normal update module lists
-	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
+	for (std::vector<SleepyUpdateEntry>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
 	{
-		(*it)->friend_setIndexInLogic(-1);
+		it->m_module->friend_setIndexInLogic(-1);
 	}
 	m_sleepyUpdates.clear();
 #ifdef ALLOW_NONSLEEPY_UPDATES
@@ -3073,9 +3075,9 @@ void GameLogic::processDestroyList()
 		UpdateModulePtr sleepyUpdatesForThisObject[MAX_SUO];
 		Int numSUO = 0;
 
-		for (std::vector<UpdateModulePtr>::iterator it2 = m_sleepyUpdates.begin(); it2 != m_sleepyUpdates.end(); ++it2)
+		for (std::vector<SleepyUpdateEntry>::iterator it2 = m_sleepyUpdates.begin(); it2 != m_sleepyUpdates.end(); ++it2)
 		{
-			UpdateModulePtr u = *it2;
+			UpdateModulePtr u = it2->m_module;
 			if (u->friend_getObject() == currentObject && numSUO < MAX_SUO)
 			{
 				sleepyUpdatesForThisObject[numSUO++] = u;
@@ -3086,7 +3088,7 @@ void GameLogic::processDestroyList()
 		{
 			// have to re-get idx each time since each call to erase might change others.
 			Int idx = sleepyUpdatesForThisObject[numSUO]->friend_getIndexInLogic();
-			DEBUG_ASSERTCRASH(m_sleepyUpdates[idx] == sleepyUpdatesForThisObject[numSUO], ("Hmm, expected update mismatch here"));
+			DEBUG_ASSERTCRASH(m_sleepyUpdates[idx].m_module == sleepyUpdatesForThisObject[numSUO], ("Hmm, expected update mismatch here"));
 			eraseSleepyUpdate(idx);
 			DEBUG_ASSERTCRASH(sleepyUpdatesForThisObject[numSUO]->friend_getIndexInLogic() == -1, ("Hmm, expected index to be -1 here"));
 		}
@@ -3338,28 +3340,29 @@ inline void GameLogic::validateSleepyUpdate() const
 	//DEBUG_LOG(("\n"));
 	//for (i = 0; i < sz; ++i)
 	//{
-	//	DEBUG_LOG(("u %04d: %08lx %08lx",i,m_sleepyUpdates[i],m_sleepyUpdates[i]->friend_getNextCallFrame()));
+	//	DEBUG_LOG(("u %04d: %08lx %08lx",i,m_sleepyUpdates[i].m_module,m_sleepyUpdates[i].m_module->friend_getNextCallFrame()));
 	//}
 	for (i = 0; i < sz; ++i)
 	{
-		DEBUG_ASSERTCRASH(m_sleepyUpdates[i]->friend_getIndexInLogic() == i, ("index mismatch: expected %d, got %d",i,m_sleepyUpdates[i]->friend_getIndexInLogic()));
-		UnsignedInt pri = m_sleepyUpdates[i]->friend_getPriority();
+		DEBUG_ASSERTCRASH(m_sleepyUpdates[i].m_module->friend_getIndexInLogic() == i, ("index mismatch: expected %d, got %d",i,m_sleepyUpdates[i].m_module->friend_getIndexInLogic()));
+		DEBUG_ASSERTCRASH(m_sleepyUpdates[i].m_priority == m_sleepyUpdates[i].m_module->friend_getPriority(), ("sleepy update priority is out of date"));
+		UnsignedInt pri = m_sleepyUpdates[i].m_priority;
 		if (i > 0)
 		{
 			Int i0 = (i+1)/2-1;
-			UnsignedInt pri0 = m_sleepyUpdates[i0]->friend_getPriority();
+			UnsignedInt pri0 = m_sleepyUpdates[i0].m_priority;
 			DEBUG_ASSERTCRASH(pri >= pri0, ("sleepyUpdates are munged (0)"));
 		}
 		Int i1 = 2*(i+1)-1;
 		Int i2 = 2*(i+1);
 		if (i1 < sz)
 		{
-			UnsignedInt pri1 = m_sleepyUpdates[i1]->friend_getPriority();
+			UnsignedInt pri1 = m_sleepyUpdates[i1].m_priority;
 			DEBUG_ASSERTCRASH(pri <= pri1, ("sleepyUpdates are munged (1)"));
 		}
 		if (i2 < sz)
 		{
-			UnsignedInt pri2 = m_sleepyUpdates[i2]->friend_getPriority();
+			UnsignedInt pri2 = m_sleepyUpdates[i2].m_priority;
 			DEBUG_ASSERTCRASH(pri <= pri2, ("sleepyUpdates are munged (2)"));
 		}
 	}
@@ -3374,13 +3377,13 @@ void GameLogic::eraseSleepyUpdate(Int i)
 	DEBUG_ASSERTCRASH(i >= 0 && i < m_sleepyUpdates.size(), ("bad sleepy idx"));
 
 	// swap with the final item, toss the final item, then rebalance
-	m_sleepyUpdates[i]->friend_setIndexInLogic(-1);
+	m_sleepyUpdates[i].m_module->friend_setIndexInLogic(-1);
 
 	Int last = m_sleepyUpdates.size() - 1;
 	if (i < last)
 	{
 		m_sleepyUpdates[i] = m_sleepyUpdates[last];
-		m_sleepyUpdates[i]->friend_setIndexInLogic(i);
+		m_sleepyUpdates[i].m_module->friend_setIndexInLogic(i);
 		m_sleepyUpdates.pop_back();
 		rebalanceSleepyUpdate(i);
 	}
@@ -3391,15 +3394,24 @@ void GameLogic::eraseSleepyUpdate(Int i)
 }
 
 // ------------------------------------------------------------------------------------------------
-inline Bool isLowerPriority(const UpdateModulePtr a, const UpdateModulePtr b)
+// TheSuperHackers @performance 18/10/2026 The queue keeps a copy of each module's priority next to it,
+// so that rebalancing compares the entries without touching the update modules themselves. The heap
+// is built and rebalanced exactly as before, so modules of equal priority still update in the same order.
+inline Bool isLowerPriority(UnsignedInt a, UnsignedInt b)
 {
 	// return true iff a is lower pri than b.
 	// remember: lower ordinal value means higher priority.
 	// therefore, higher ordinal value means lower priority.
-	DEBUG_ASSERTCRASH(a && b, ("these may no longer be null"));
-	UnsignedInt f1 = a->friend_getPriority();
-	UnsignedInt f2 = b->friend_getPriority();
-	return f1 > f2;
+	return a > b;
+}
+
+// ------------------------------------------------------------------------------------------------
+// must be called after changing the wake frame of a module that is in the queue, before rebalancing.
+inline void GameLogic::refreshSleepyUpdatePriority(UpdateModulePtr u)
+{
+	Int idx = u->friend_getIndexInLogic();
+	if (idx >= 0)
+		m_sleepyUpdates[idx].m_priority = u->friend_getPriority();
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -3410,16 +3422,16 @@ Int GameLogic::rebalanceParentSleepyUpdate(Int i)
 	DEBUG_ASSERTCRASH(i >= 0 && i < m_sleepyUpdates.size(), ("bad sleepy idx"));
 
 	Int parent = ((i+1)>>1)-1;
-	while (parent >= 0 && isLowerPriority(m_sleepyUpdates[parent], m_sleepyUpdates[i]))
+	while (parent >= 0 && isLowerPriority(m_sleepyUpdates[parent].m_priority, m_sleepyUpdates[i].m_priority))
 	{
-		UpdateModulePtr a = m_sleepyUpdates[parent];
-		UpdateModulePtr b = m_sleepyUpdates[i];
+		SleepyUpdateEntry a = m_sleepyUpdates[parent];
+		SleepyUpdateEntry b = m_sleepyUpdates[i];
 
 		m_sleepyUpdates[i] = a;
 		m_sleepyUpdates[parent] = b;
 
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(parent);
+		a.m_module->friend_setIndexInLogic(i);
+		b.m_module->friend_setIndexInLogic(parent);
 
 		i = parent;
 		parent = ((parent+1)>>1)-1;
@@ -3440,37 +3452,37 @@ Int GameLogic::rebalanceChildSleepyUpdate(Int i)
 // max efficiency. I have left the pristine non-unrolled
 // version present for clarity. (Yes, this is worth doing.) (srj)
 #if 1
-	UpdateModulePtr* pI = &m_sleepyUpdates[i];
+	SleepyUpdateEntry* pI = &m_sleepyUpdates[i];
 
 	// our children are i*2 and i*2+1
   Int child = ((i)<<1)+1;
-	UpdateModulePtr* pChild = &m_sleepyUpdates[0] + child;
-	UpdateModulePtr* pSZ = &m_sleepyUpdates[0] + m_sleepyUpdates.size();	// yes, this is off the end.
+	SleepyUpdateEntry* pChild = &m_sleepyUpdates[0] + child;
+	SleepyUpdateEntry* pSZ = &m_sleepyUpdates[0] + m_sleepyUpdates.size();	// yes, this is off the end.
 
   while (pChild < pSZ)
 	{
 		// choose the higher-priority of the two children; we must be higher-pri than that.
-		if (pChild < pSZ-1 && isLowerPriority(*pChild, *(pChild+1)))
+		if (pChild < pSZ-1 && isLowerPriority(pChild->m_priority, (pChild+1)->m_priority))
 		{
       ++pChild;
 			++child;
 		}
 
 		// if we're higher-pri than our children, we're done.
-		if (!isLowerPriority(*pI, *pChild))
+		if (!isLowerPriority(pI->m_priority, pChild->m_priority))
 		{
 			break;
 		}
 
 		// doh. swap with the highest-pri child we have.
-		UpdateModulePtr a = *pChild;
-		UpdateModulePtr b = *pI;
+		SleepyUpdateEntry a = *pChild;
+		SleepyUpdateEntry b = *pI;
 
 		*pI = a;
 		*pChild = b;
 
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(child);
+		a.m_module->friend_setIndexInLogic(i);
+		b.m_module->friend_setIndexInLogic(child);
 
 		i = child;
 		pI = pChild;
@@ -3485,24 +3497,24 @@ Int GameLogic::rebalanceChildSleepyUpdate(Int i)
   while (child < sz)
 	{
 		// choose the higher-priority of the two children; we must be higher-pri than that.
-		if (child < sz-1 && isLowerPriority(m_sleepyUpdates[child], m_sleepyUpdates[child+1]))
+		if (child < sz-1 && isLowerPriority(m_sleepyUpdates[child].m_priority, m_sleepyUpdates[child+1].m_priority))
       ++child;
 
 		// if we're higher-pri than our children, we're done.
-		if (!isLowerPriority(m_sleepyUpdates[i], m_sleepyUpdates[child]))
+		if (!isLowerPriority(m_sleepyUpdates[i].m_priority, m_sleepyUpdates[child].m_priority))
 		{
 			break;
 		}
 
 		// doh. swap with the highest-pri child we have.
-		UpdateModulePtr a = m_sleepyUpdates[child];
-		UpdateModulePtr b = m_sleepyUpdates[i];
+		SleepyUpdateEntry a = m_sleepyUpdates[child];
+		SleepyUpdateEntry b = m_sleepyUpdates[i];
 
 		m_sleepyUpdates[i] = a;
 		m_sleepyUpdates[child] = b;
 
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(child);
+		a.m_module->friend_setIndexInLogic(i);
+		b.m_module->friend_setIndexInLogic(child);
 		i = child;
 		child = ((i)<<1)+1;
   }
@@ -3544,7 +3556,7 @@ void GameLogic::pushSleepyUpdate(UpdateModulePtr u, Bool rebalanceQueue)
 
 	DEBUG_ASSERTCRASH(u != nullptr, ("You may not pass null for sleepy update info"));
 
-	m_sleepyUpdates.push_back(u);
+	m_sleepyUpdates.push_back(SleepyUpdateEntry(u));
 	u->friend_setIndexInLogic(m_sleepyUpdates.size() - 1);
 
 	//MODDD - checked by param
@@ -3558,7 +3570,7 @@ UpdateModulePtr GameLogic::peekSleepyUpdate() const
 {
 	USE_PERF_TIMER(SleepyMaintenance)
 
-	UpdateModulePtr u = m_sleepyUpdates.front();
+	UpdateModulePtr u = m_sleepyUpdates.front().m_module;
 	DEBUG_ASSERTCRASH(u->friend_getIndexInLogic() == 0, ("index mismatch: expected %d, got %d",0,u->friend_getIndexInLogic()));
 	return u;
 }
@@ -3575,11 +3587,11 @@ void GameLogic::popSleepyUpdate()
 		return;
 	}
 
-	m_sleepyUpdates[0]->friend_setIndexInLogic(-1);
+	m_sleepyUpdates[0].m_module->friend_setIndexInLogic(-1);
 	if (sz > 1)
 	{
 		m_sleepyUpdates[0] = m_sleepyUpdates[sz-1];
-		m_sleepyUpdates[0]->friend_setIndexInLogic(0);
+		m_sleepyUpdates[0].m_module->friend_setIndexInLogic(0);
 		m_sleepyUpdates.pop_back();
 		rebalanceChildSleepyUpdate(0);
 	}
@@ -3644,7 +3656,7 @@ void GameLogic::friend_awakenUpdateModule(Object* obj, UpdateModulePtr u, Unsign
 			return;
 		}
 
-		if (m_sleepyUpdates[idx] != u)
+		if (m_sleepyUpdates[idx].m_module != u)
 		{
 			RELEASE_CRASH("fatal error! sleepy update module index mismatch.");
 			return;
@@ -3652,6 +3664,7 @@ void GameLogic::friend_awakenUpdateModule(Object* obj, UpdateModulePtr u, Unsign
 
 		// update the value.
 		u->friend_setNextCallFrame(whenToWakeUp);
+		refreshSleepyUpdatePriority(u);
 
 		// rebalance.
 		rebalanceSleepyUpdate(idx);
@@ -4334,6 +4347,12 @@ void GameLogic::update()
 
 	// send the current time to the GameClient
 	UnsignedInt now = getFrame();
+	if (TheLogicFrameProfile != nullptr)
+		TheLogicFrameProfile->beginFrame(now);
+
+	// TheSuperHackers @feature 18/10/2026 Snapshots are taken before anything of this frame is executed.
+	if (TheRecorder && TheRecorder->isPlaybackMode())
+		TheRecorder->updatePlaybackSnapshot();
 	TheGameClient->setFrame(now);
 	
 #if REAL_TIME_TOD_CHANGE
@@ -4347,6 +4366,7 @@ void GameLogic::update()
 
 	// update (execute) scripts
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_SCRIPT_ENGINE)
 		TheScriptEngine->UPDATE();
 	}
 
@@ -4354,11 +4374,17 @@ void GameLogic::update()
 	TheFramePacer->setTimeFrozen(TheGameEngine->isTimeFrozen());
 
 	if (TheFramePacer->isTimeFrozen())
+	{
+		// The frozen frame still gets its row, so that its script engine time does not carry over.
+		if (TheLogicFrameProfile != nullptr)
+			TheLogicFrameProfile->endFrame(getObjectCount(), getNumberSleepyUpdates());
 		return;
+	}
 
 	// Note - TerrainLogic update needs to happen after ScriptEngine update, but before object updates.  jba.
 	// This way changes in bridges are noted in the script engine before being cleared in TerrainLogic->update
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_TERRAIN_LOGIC)
 		TheTerrainLogic->UPDATE();
 	}
 
@@ -4376,6 +4402,7 @@ void GameLogic::update()
 
 	if (generateForSolo || generateForMP)
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_CRC)
 		m_CRC = getCRC( CRC_RECALC );
 		bool isPlayback = (TheRecorder && TheRecorder->isPlaybackMode());
 
@@ -4407,11 +4434,13 @@ void GameLogic::update()
 
 	// process client commands
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_COMMAND_LIST)
 		processCommandList( TheCommandList );
 	}
 
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_NORMAL_UPDATES)
 		for (std::list<UpdateModulePtr>::const_iterator it = m_normalUpdates.begin(); it != m_normalUpdates.end(); ++it)
 		{
 			UpdateModulePtr u = *it;
@@ -4429,6 +4458,7 @@ void GameLogic::update()
 				USE_PERF_TIMER(GameLogic_update_normal)
 
 				m_curUpdateModule = u;
+				u->friend_getObject()->markCRCDirty();
 
 				#ifdef DEBUG_LOGGING
 					UpdateSleepTime sleep = u->update();
@@ -4444,6 +4474,7 @@ void GameLogic::update()
 #endif
 
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_SLEEPY_UPDATES)
 		while (!m_sleepyUpdates.empty())
 		{
 			UpdateModulePtr u = peekSleepyUpdate();
@@ -4495,18 +4526,28 @@ void GameLogic::update()
 
 				//DEBUG_LOG(("calling update %08lx (%d %d)...",update,update->friend_getNextCallFrame(),update->friend_getNextCallPhase()));
 				m_curUpdateModule = u;
+				u->friend_getObject()->markCRCDirty();
+
+				const Int64 profileStart = TheUpdateModuleProfile ? TheUpdateModuleProfile->getTicks() : 0;
 
 				sleepLen = u->update();
 				DEBUG_ASSERTCRASH(sleepLen > 0, ("you may not return 0 from update"));
 				if (sleepLen < 1)
 					sleepLen = UPDATE_SLEEP_NONE;
 
+				if (TheUpdateModuleProfile)
+				{
+					TheUpdateModuleProfile->addCall(u->getModuleNameKey(), u->friend_getObject()->getTemplate(),
+						TheUpdateModuleProfile->getTicks() - profileStart, sleepLen);
+				}
+
 				m_curUpdateModule = nullptr;
 
 			}
 
 			// else defer it till next frame and re-push it
 			u->friend_setNextCallFrame(now + sleepLen);
+			refreshSleepyUpdatePriority(u);
 			rebalanceSleepyUpdate(0);
 		}
 	}
@@ -4515,6 +4556,7 @@ void GameLogic::update()
 
 	// update the Artificial Intelligence system
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_AI)
 		TheAI->UPDATE();
 	}
 
@@ -4525,6 +4567,7 @@ void GameLogic::update()
 
 	// update partition info
 	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_PARTITION_MANAGER)
 		ThePartitionManager->UPDATE();
 	}
 
@@ -4533,7 +4576,10 @@ void GameLogic::update()
 	//
 
 	// destroy all pending objects
-	processDestroyList();
+	{
+		USE_LOGIC_FRAME_STAGE(LOGIC_FRAME_STAGE_DESTROY_LIST)
+		processDestroyList();
+	}
 
 	// reset the command list, destroying all messages
 	TheCommandList->reset();
@@ -4557,6 +4603,9 @@ void GameLogic::update()
 
 
 
+	if (TheLogicFrameProfile != nullptr)
+		TheLogicFrameProfile->endFrame(getObjectCount(), getNumberSleepyUpdates());
+
 	// increment world time
 	if (!m_startNewGame)
 	{
@@ -4922,6 +4971,58 @@ UnsignedInt GameLogic::getCRC( Int mode, AsciiString deepCRCFileName )
 	return theCRC;
 }
 
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance 18/10/2026
+	* The CRC of getCRC is one rotate and add over the whole game state, so it cannot be put
+	* together from the CRC of its parts. This is a different CRC over the same objects and partition
+	* cells that only runs the objects and cells through their crc method again that changed since
+	* the last call, and takes the cached CRC for all others. It is cheap enough to be made every
+	* frame, which shows the first frame on which two runs of a replay differ. It is not sent to the
+	* other players and does not replace getCRC. */
+// ------------------------------------------------------------------------------------------------
+UnsignedInt GameLogic::getIncrementalCRC()
+{
+	setFPMode();
+
+	LatchRestore<Bool> latch(inCRCGen, !isInGameLogicUpdate());
+
+	XferCRC xferCRC;
+	xferCRC.open("incrementalCRC");
+
+	for( Object *obj = m_objList; obj; obj=obj->getNextObject() )
+	{
+		if (obj->isCRCDirty())
+		{
+			obj->setCachedCRC(XferCRC::calcSnapshotCRC(obj));
+		}
+#ifdef RTS_DEBUG
+		else
+		{
+			const UnsignedInt fullCRC = XferCRC::calcSnapshotCRC(obj);
+			DEBUG_ASSERTCRASH(fullCRC == obj->getCachedCRC(), ("Object %d (%s) changed on frame %d without markCRCDirty",
+				obj->getID(), obj->getTemplate()->getName().str(), m_frame));
+			obj->setCachedCRC(fullCRC);
+		}
+#endif
+
+		ObjectID id = obj->getID();
+		UnsignedInt objCRC = obj->getCachedCRC();
+		xferCRC.xferObjectID(&id);
+		xferCRC.xferUnsignedInt(&objCRC);
+	}
+
+	UnsignedInt seed = GetGameLogicRandomSeedCRC();
+	xferCRC.xferUnsignedInt(&seed);
+
+	ThePartitionManager->crcIncremental(&xferCRC);
+
+	xferCRC.xferSnapshot(ThePlayerList);
+	xferCRC.xferSnapshot(TheAI);
+
+	xferCRC.close();
+	return xferCRC.getCRC();
+}
+
 //MODDD - moved from GameLogic.h
 Object* GameLogic::findObjectByID( ObjectID id )
 {